@@ -21,12 +21,314 @@ Copyright (C) 2014 Justin Adams
 #define  UNICODER_C  1
 
 
+/* ftruncate, fdopen, strnlen and clock_gettime are POSIX, which a strict -std=c99 build has to ask for */
+#if !defined(_POSIX_C_SOURCE)  &&  !defined(_XOPEN_SOURCE)
+#define  _POSIX_C_SOURCE  200809L
+#endif
+
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+/* whole file transcoding maps files where it can, and falls back to stdio elsewhere */
+#if defined(__unix__)  ||  defined(__APPLE__)
+#define  UNICODER_MMAP  1
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#if !defined(__APPLE__)
+#define  UNICODER_FALLOCATE  1
+#endif
+#endif
+
+/* the stream reader refills with read(2) on the file's descriptor, which does not wait for a full */
+/* buffer on pipes; define UNICODER_NO_POSIX_READ to have it go through fread everywhere */
+#if (defined(__unix__)  ||  defined(__APPLE__))  &&  !defined(UNICODER_NO_POSIX_READ)
+#define  UNICODER_POSIX_READ  1
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+/* parallel transcoding needs pthreads (link with -lpthread), define UNICODER_NO_THREADS to leave it out */
+#if (defined(__unix__)  ||  defined(__APPLE__))  &&  !defined(UNICODER_NO_THREADS)
+#define  UNICODER_THREADS  1
+#include <pthread.h>
+#endif
+
+/* gcc and clang on x86 build every vector tier, each under its own target attribute, and pick one at */
+/* run time; UNICODER_NO_DISPATCH, like any other compiler, gets only what the build flags allow */
+#if defined(__GNUC__)  &&  (defined(__x86_64__)  ||  defined(__i386__))  &&  !defined(UNICODER_NO_DISPATCH)
+#define  UNICODER_DISPATCH  1
+#define  UNICODER_SSE       1
+#define  UNICODER_AVX2      1
+#define  UNICODER_AVX512    1
+#define  UNICODER_TARGET_SSE     __attribute__((target("sse4.1")))
+#define  UNICODER_TARGET_AVX2    __attribute__((target("avx2")))
+#define  UNICODER_TARGET_AVX512  __attribute__((target("avx2,avx512f,avx512bw,avx512vl,avx512vbmi2,popcnt")))
+#else
+#if defined(__SSE4_1__)
+#define  UNICODER_SSE  1
+#endif
+#if defined(__AVX2__)
+#define  UNICODER_AVX2  1
+#endif
+#if defined(__AVX2__)  &&  defined(__AVX512BW__)  &&  defined(__AVX512VL__)  &&  defined(__AVX512VBMI2__)
+#define  UNICODER_AVX512  1
+#endif
+#define  UNICODER_TARGET_SSE
+#define  UNICODER_TARGET_AVX2
+#define  UNICODER_TARGET_AVX512
+#endif
+
+#if defined(UNICODER_SSE)  ||  defined(UNICODER_AVX2)
+#define  UNICODER_SIMD  1
+#include <immintrin.h>
+#endif
+
 #include "unicoder.h"
 
 
+/* the bulk paths rely on the step functions below being folded into each transcoding loop */
+#if defined(__GNUC__)
+#define  UNICODER_INLINE  static __inline__ __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define  UNICODER_INLINE  static __forceinline
+#else
+#define  UNICODER_INLINE  static
+#endif
+
+
+
+
+
+
+/*
+Instrumentation.
+
+Built with UNICODER_STATS the library counts code points, bytes and error returns per encoding at a
+handful of entry points, and with UNICODER_STATS_TIMERS as well it times the bulk and file paths.
+Without them every macro below is empty, so the counted functions compile to what they were.
+Counters are bumped with relaxed atomics where the compiler has them, since unicoder_transcodeParallel
+counts from several threads at once.
+*/
+
+#if defined(UNICODER_STATS)
+
+static unicoder_stats unicoder_statsCounters;
+
+#if defined(__GNUC__)
+#define  UNICODER_STATS_ADD(field, n)  __atomic_fetch_add(&unicoder_statsCounters.field, (unsigned long long) (n), __ATOMIC_RELAXED)
+#else
+#define  UNICODER_STATS_ADD(field, n)  (unicoder_statsCounters.field += (unsigned long long) (n))
+#endif
+
+
+/* counts ret against its error code if it is one, returns ret */
+static int unicoder_statsError(int ret)
+{
+	unsigned int i, code;
+
+	if(ret >= 0)
+		return ret;
+
+	code= (unsigned int) -ret;
+	for(i= 0; i < UNICODER_STATS_ERRORS - 1  &&  (code >> i) > 1; i++)
+		;
+
+	UNICODER_STATS_ADD(errors[i], 1);
+	return ret;
+}
+
+
+/* counts one code point of ret bytes read in encoding, or the error, returns ret */
+static int unicoder_statsRead(unsigned int encoding, int ret)
+{
+	if(ret < 0  ||  encoding >= UNICODER_STATS_ENCODINGS)
+		return unicoder_statsError(ret);
+
+	UNICODER_STATS_ADD(codePointsRead[encoding], 1);
+	UNICODER_STATS_ADD(bytesRead[encoding], ret);
+	return ret;
+}
+
+
+/* counts one code point of ret bytes written in encoding, or the error, returns ret */
+static int unicoder_statsWrite(unsigned int encoding, int ret)
+{
+	if(ret < 0  ||  encoding >= UNICODER_STATS_ENCODINGS)
+		return unicoder_statsError(ret);
+
+	UNICODER_STATS_ADD(codePointsWritten[encoding], 1);
+	UNICODER_STATS_ADD(bytesWritten[encoding], ret);
+	return ret;
+}
+
+
+/* counts the code points in len bytes already known to be well formed */
+static size_t unicoder_statsCodePoints(const unsigned char* p, size_t len, unsigned int encoding)
+{
+	size_t i, n= 0;
+
+	switch(encoding)
+	{
+		case UNICODER_UTF8:
+			for(i= 0; i < len; i++)
+				n += (p[i] & 0xc0) != 0x80;
+			return n;
+
+		/* every low surrogate ends a pair that is one code point */
+		case UNICODER_UTF16BE:
+			for(i= 0; i < len; i += 2)
+				n += (p[i] & 0xfc) != 0xdc;
+			return n;
+
+		case UNICODER_UTF16LE:
+			for(i= 1; i < len; i += 2)
+				n += (p[i] & 0xfc) != 0xdc;
+			return n;
+
+		case UNICODER_UTF32BE:
+		case UNICODER_UTF32LE:
+			return len / 4;
+	}
+
+	return len;
+}
+
+
+/* counts a bulk conversion of in bytes of src into out bytes, and its return code, returns ret */
+static int unicoder_statsTranscode(const unsigned char* src, size_t in, unsigned int srcEncoding,
+                                   size_t out, unsigned int dstEncoding, int ret)
+{
+	size_t codePoints;
+
+	if(in > 0)
+	{
+		/* a fixed width destination gives the count away for free */
+		if(dstEncoding == UNICODER_UTF32BE  ||  dstEncoding == UNICODER_UTF32LE)
+			codePoints= out / 4;
+		else if(dstEncoding == UNICODER_ASCII  ||  dstEncoding >= UNICODER_ISO8859_1)
+			codePoints= out;
+		else
+			codePoints= unicoder_statsCodePoints(src, in, srcEncoding);
+
+		UNICODER_STATS_ADD(codePointsRead[srcEncoding], codePoints);
+		UNICODER_STATS_ADD(bytesRead[srcEncoding], in);
+		UNICODER_STATS_ADD(codePointsWritten[dstEncoding], codePoints);
+		UNICODER_STATS_ADD(bytesWritten[dstEncoding], out);
+	}
+
+	return unicoder_statsError(ret);
+}
+
+#define  UNICODER_STATS_ERROR(ret)  unicoder_statsError(ret)
+#define  UNICODER_STATS_READ(encoding, ret)  unicoder_statsRead(encoding, ret)
+#define  UNICODER_STATS_WRITE(encoding, ret)  unicoder_statsWrite(encoding, ret)
+#define  UNICODER_STATS_TRANSCODE(src, in, srcEncoding, out, dstEncoding, ret)  \
+	unicoder_statsTranscode(src, in, srcEncoding, out, dstEncoding, ret)
+
+#else
+
+#define  UNICODER_STATS_ERROR(ret)  (ret)
+#define  UNICODER_STATS_READ(encoding, ret)  (ret)
+#define  UNICODER_STATS_WRITE(encoding, ret)  (ret)
+#define  UNICODER_STATS_TRANSCODE(src, in, srcEncoding, out, dstEncoding, ret)  (ret)
+
+#endif
+
+
+#if defined(UNICODER_STATS)  &&  defined(UNICODER_STATS_TIMERS)
+
+#if !defined(__GNUC__)  ||  !(defined(__x86_64__)  ||  defined(__i386__))
+#include <time.h>
+#endif
+
+static unsigned long long unicoder_statsClock(void)
+{
+#if defined(__GNUC__)  &&  (defined(__x86_64__)  ||  defined(__i386__))
+	return __builtin_ia32_rdtsc();
+#elif defined(__unix__)  ||  defined(__APPLE__)
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (unsigned long long) t.tv_sec * 1000000000ull + (unsigned long long) t.tv_nsec;
+#else
+	return (unsigned long long) ((double) clock() * (1e9 / CLOCKS_PER_SEC));
+#endif
+}
+
+#define  UNICODER_TIMER_DECLARE(t)  unsigned long long t;
+#define  UNICODER_TIMER_START(t)  (t)= unicoder_statsClock()
+#define  UNICODER_TIMER_STOP(t, timer)                                                  \
+	do                                                                                  \
+	{                                                                                   \
+		UNICODER_STATS_ADD(cycles[timer], unicoder_statsClock() - (t));                 \
+		UNICODER_STATS_ADD(calls[timer], 1);                                            \
+	} while(0)
+
+#else
+
+#define  UNICODER_TIMER_DECLARE(t)
+#define  UNICODER_TIMER_START(t)
+#define  UNICODER_TIMER_STOP(t, timer)
+
+#endif
+
+
+/* copies the counters into stats, returns 0 or error code */
+int unicoder_stats_snapshot(unicoder_stats* stats)
+{
+#if defined(UNICODER_STATS)
+	const unsigned long long* from= (const unsigned long long*) &unicoder_statsCounters;
+	unsigned long long* to;
+	size_t i;
+#endif
+
+	if(stats == NULL)
+		return UNICODER_NULL_POINTER;
+
+	memset(stats, 0, sizeof(unicoder_stats));
+
+#if defined(UNICODER_STATS)
+	/* the struct is nothing but counters, each one read on its own */
+	to= (unsigned long long*) stats;
+	for(i= 0; i < sizeof(unicoder_stats) / sizeof(unsigned long long); i++)
+	{
+#if defined(__GNUC__)
+		to[i]= __atomic_load_n(from + i, __ATOMIC_RELAXED);
+#else
+		to[i]= from[i];
+#endif
+	}
+
+	return 0;
+#else
+	return UNICODER_NOT_SUPPORTED;
+#endif
+}
+
+
+/* sets every counter back to 0 */
+void unicoder_stats_reset(void)
+{
+#if defined(UNICODER_STATS)
+	unsigned long long* p= (unsigned long long*) &unicoder_statsCounters;
+	size_t i;
+
+	for(i= 0; i < sizeof(unicoder_stats) / sizeof(unsigned long long); i++)
+	{
+#if defined(__GNUC__)
+		__atomic_store_n(p + i, 0, __ATOMIC_RELAXED);
+#else
+		p[i]= 0;
+#endif
+	}
+#endif
+}
+
+
 
 
 
@@ -72,28 +374,14 @@ int unicoder_reverseEndianness(unsigned char* src, unsigned char* dest, unsigned
 /* uses byte order mark to determine encoding type */
 int unicoder_decodeBom(unsigned char* p)
 {
-	int i;
 	unsigned int len;
 	unsigned char newp[4];
 
 	if(p == NULL)
 		return UNICODER_NULL_POINTER;
 
-	for(i= 0; i < 4; i++)
-		newp[i]= 0;
-
-	/* this is weird, but it's the best way I can think of to do it portably */
-	/* ATTN, in the future this could be a portability concern */
-	strncpy(newp, p, 4);
-	strncpy(newp + 1, p + 1, 3);
-	strncpy(newp + 2, p + 2, 2);
-	strncpy(newp + 3, p + 3, 1);
-
-	/* this is for debugging
-	for(i= 0; i < 4; i++)
-		printf("<%d>\n", newp[i]);
-	printf("\n\n");
-	*/
+	/* a plain copy, byte order marks are full of zero bytes */
+	memcpy(newp, p, 4);
 
 	/* 00 00 FE FF*/
 	if((newp[0] == 0x00) && (newp[1] == 0x00) && (newp[2] == 0xfe) && (newp[3] == 0xff))
@@ -123,7 +411,7 @@ int unicoder_decodeBom(unsigned char* p)
 /* uses byte order mark to determine encoding type */
 int unicoder_decodeBomFromFile(FILE* f)
 {
-	int i, currChar;
+	int i, currChar, encoding;
 	long originalPosition;
 	unsigned char bytes[4];
 
@@ -147,7 +435,13 @@ int unicoder_decodeBomFromFile(FILE* f)
 
 	fseek(f, originalPosition, SEEK_SET);
 
-	return unicoder_decodeBom(bytes);
+	encoding= unicoder_decodeBom(bytes);
+
+	/* a file that ends after FF FE starts with a utf-16le mark, the zeros above are not in it */
+	if(encoding == UNICODER_UTF32LE  &&  i < 4)
+		encoding= UNICODER_UTF16LE;
+
+	return encoding;
 }
 
 
@@ -155,6 +449,10 @@ int unicoder_decodeBomFromFile(FILE* f)
    Bit-level endianness is handled by hardware. */
 unsigned int unicoder_uint32_reverseByteEndian(unsigned int x)
 {
+#if defined(__GNUC__)
+	/* one bswap instruction */
+	return __builtin_bswap32(x);
+#else
 	unsigned int ret= 0;
 
 	ret |= x & 0x000000ff;
@@ -167,6 +465,7 @@ unsigned int unicoder_uint32_reverseByteEndian(unsigned int x)
 
 
 	return ret;
+#endif
 }
 
 
@@ -174,14 +473,127 @@ unsigned int unicoder_uint32_reverseByteEndian(unsigned int x)
 
 
 
+/*
+utf-8 decoding is driven by a small state machine (after Bjoern Hoehrmann's design).
+unicoder_utf8Class maps every byte to one of 12 classes, unicoder_utf8Transition maps
+(state + class) to the next state. States are multiples of 12 so they index the table directly.
+Each byte costs one lookup in each table and no data dependent branches, and since the machine
+only accepts shortest forms below 0x110000 outside the surrogate block it rejects overlongs,
+encoded surrogates and values that are too large in the same step.
+*/
+
+#define  UNICODER_UTF8_ACCEPT   0
+#define  UNICODER_UTF8_REJECT  12
+
+static const unsigned char unicoder_utf8Class[256]=
+{
+	 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 00..1F */
+	 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 20..3F */
+	 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 40..5F */
+	 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 60..7F */
+	 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, /* 80..9F */
+	 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, /* A0..BF */
+	 8, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, /* C0..DF */
+	10, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 11, 6, 6, 6, 5, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8  /* E0..FF */
+};
+
+static const unsigned char unicoder_utf8Transition[108]=
+{
+	 0, 12, 24, 36, 60, 96, 84, 12, 12, 12, 48, 72, /*  0: accept, between code points */
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, /* 12: reject */
+	12,  0, 12, 12, 12, 12, 12,  0, 12,  0, 12, 12, /* 24: one continuation left */
+	12, 24, 12, 12, 12, 12, 12, 24, 12, 24, 12, 12, /* 36: two continuations left */
+	12, 12, 12, 12, 12, 12, 12, 24, 12, 12, 12, 12, /* 48: after E0, needs A0..BF */
+	12, 24, 12, 12, 12, 12, 12, 12, 12, 24, 12, 12, /* 60: after ED, needs 80..9F */
+	12, 12, 12, 12, 12, 12, 12, 36, 12, 36, 12, 12, /* 72: after F0, needs 90..BF */
+	12, 36, 12, 12, 12, 12, 12, 36, 12, 36, 12, 12, /* 84: after F1..F3, three continuations left */
+	12, 36, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12  /* 96: after F4, needs 80..8F */
+};
+
+
+/*
+the same machine packed for straight validation: row [byte] holds the next state for every current state,
+6 bits each, and states are the bit offsets of their own slot. The next state is then one shift away from
+the current one, so a long run of bytes is not held up by a table lookup per byte.
+*/
+
+#define  UNICODER_UTF8_ROW_ACCEPT  0
+#define  UNICODER_UTF8_ROW_REJECT  6
+
+static const unsigned long long unicoder_utf8Rows[256]=
+{
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 00..03 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 04..07 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 08..0B */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 0C..0F */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 10..13 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 14..17 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 18..1B */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 1C..1F */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 20..23 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 24..27 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 28..2B */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 2C..2F */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 30..33 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 34..37 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 38..3B */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 3C..3F */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 40..43 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 44..47 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 48..4B */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 4C..4F */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 50..53 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 54..57 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 58..5B */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 5C..5F */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 60..63 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 64..67 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 68..6B */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 6C..6F */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 70..73 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 74..77 */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 78..7B */
+	0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, 0x0006186186186180ull, /* 7C..7F */
+	0x0012486306300186ull, 0x0012486306300186ull, 0x0012486306300186ull, 0x0012486306300186ull, /* 80..83 */
+	0x0012486306300186ull, 0x0012486306300186ull, 0x0012486306300186ull, 0x0012486306300186ull, /* 84..87 */
+	0x0012486306300186ull, 0x0012486306300186ull, 0x0012486306300186ull, 0x0012486306300186ull, /* 88..8B */
+	0x0012486306300186ull, 0x0012486306300186ull, 0x0012486306300186ull, 0x0012486306300186ull, /* 8C..8F */
+	0x0006492306300186ull, 0x0006492306300186ull, 0x0006492306300186ull, 0x0006492306300186ull, /* 90..93 */
+	0x0006492306300186ull, 0x0006492306300186ull, 0x0006492306300186ull, 0x0006492306300186ull, /* 94..97 */
+	0x0006492306300186ull, 0x0006492306300186ull, 0x0006492306300186ull, 0x0006492306300186ull, /* 98..9B */
+	0x0006492306300186ull, 0x0006492306300186ull, 0x0006492306300186ull, 0x0006492306300186ull, /* 9C..9F */
+	0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, /* A0..A3 */
+	0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, /* A4..A7 */
+	0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, /* A8..AB */
+	0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, /* AC..AF */
+	0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, /* B0..B3 */
+	0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, /* B4..B7 */
+	0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, /* B8..BB */
+	0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, 0x000649218c300186ull, /* BC..BF */
+	0x0006186186186186ull, 0x0006186186186186ull, 0x000618618618618cull, 0x000618618618618cull, /* C0..C3 */
+	0x000618618618618cull, 0x000618618618618cull, 0x000618618618618cull, 0x000618618618618cull, /* C4..C7 */
+	0x000618618618618cull, 0x000618618618618cull, 0x000618618618618cull, 0x000618618618618cull, /* C8..CB */
+	0x000618618618618cull, 0x000618618618618cull, 0x000618618618618cull, 0x000618618618618cull, /* CC..CF */
+	0x000618618618618cull, 0x000618618618618cull, 0x000618618618618cull, 0x000618618618618cull, /* D0..D3 */
+	0x000618618618618cull, 0x000618618618618cull, 0x000618618618618cull, 0x000618618618618cull, /* D4..D7 */
+	0x000618618618618cull, 0x000618618618618cull, 0x000618618618618cull, 0x000618618618618cull, /* D8..DB */
+	0x000618618618618cull, 0x000618618618618cull, 0x000618618618618cull, 0x000618618618618cull, /* DC..DF */
+	0x0006186186186198ull, 0x0006186186186192ull, 0x0006186186186192ull, 0x0006186186186192ull, /* E0..E3 */
+	0x0006186186186192ull, 0x0006186186186192ull, 0x0006186186186192ull, 0x0006186186186192ull, /* E4..E7 */
+	0x0006186186186192ull, 0x0006186186186192ull, 0x0006186186186192ull, 0x0006186186186192ull, /* E8..EB */
+	0x0006186186186192ull, 0x000618618618619eull, 0x0006186186186192ull, 0x0006186186186192ull, /* EC..EF */
+	0x00061861861861a4ull, 0x00061861861861aaull, 0x00061861861861aaull, 0x00061861861861aaull, /* F0..F3 */
+	0x00061861861861b0ull, 0x0006186186186186ull, 0x0006186186186186ull, 0x0006186186186186ull, /* F4..F7 */
+	0x0006186186186186ull, 0x0006186186186186ull, 0x0006186186186186ull, 0x0006186186186186ull, /* F8..FB */
+	0x0006186186186186ull, 0x0006186186186186ull, 0x0006186186186186ull, 0x0006186186186186ull  /* FC..FF */
+};
+
+
 /* decodes utf-8 code point at p, stores uint32 in result, returns error code or number of bytes read */
 int unicoder_utf8_decode(unsigned int* result, unsigned char* p)
 {
 	int i;
-	int numBytes= 0;
-	unsigned int decoded= 0;
-	unsigned char currByte;
-	const int debug_utf8_decode= 0;
+	unsigned int state, type, decoded;
 
 	if(result == NULL)
 		return UNICODER_NULL_POINTER;
@@ -200,68 +612,25 @@ int unicoder_utf8_decode(unsigned int* result, unsigned char* p)
 	0001 0000-0010 FFFF | 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
 	*/
 
-	currByte= *p;
-
-	if((numBytes == 0) && ((currByte & 0x80) == 0x00))
-		numBytes= 1;
-	if((numBytes == 0) && ((currByte & 0xe0) == 0xc0))
-		numBytes= 2;
-	if((numBytes == 0) && ((currByte & 0xf0) == 0xe0))
-		numBytes= 3;
-	if((numBytes == 0) && ((currByte & 0xf8) == 0xf0))
-		numBytes= 4;
-	if(numBytes == 0)
-		return UNICODER_INVALID_BYTE_SEQUENCE;
+	/* the class also says how many payload bits the lead byte carries */
+	type= unicoder_utf8Class[*p];
+	decoded= (0xff >> type) & *p;
+	state= unicoder_utf8Transition[type];
 
-	for(i= 0; i < numBytes; i++)
+	/* states above reject still want continuation bytes; stops reading at the first bad one */
+	for(i= 1; state > UNICODER_UTF8_REJECT; i++)
 	{
-		currByte= *(p + i);
-
-		if(i == 0)
-		{
-			switch(numBytes)
-			{
-				case 1: decoded= (0x7f & currByte);
-					break;
-				case 2: decoded= (0x1f & currByte);
-					break;
-				case 3: decoded= (0x0f & currByte);
-					break;
-				case 4: decoded= (0x07 & currByte);
-					break;
-				default:
-					return UNICODER_UNPOSSIBLE;
-			};
-		}
-
-		else
-		{
-			/* should have 10xx xxxx for each byte after first */
-			if((currByte & 0xc0) != 0x80)
-				return UNICODER_INVALID_BYTE_SEQUENCE;
-
-			if(debug_utf8_decode == 1) printf("\t%08x\n", decoded);
-			decoded <<= 6;
-			if(debug_utf8_decode == 1) printf("\t%08x\n", decoded);
-			decoded |= (currByte & 0x3f);
-			if(debug_utf8_decode == 1) printf("\t%08x\n", decoded);
-		}
-
-		if(debug_utf8_decode == 1) printf("%08x\n", decoded);
+		type= unicoder_utf8Class[*(p + i)];
+		decoded= (decoded << 6) | (*(p + i) & 0x3f);
+		state= unicoder_utf8Transition[state + type];
 	}
 
-	/* max unicode code point is 0x10ffff */
-	if(decoded > 0x10ffff)
-		return UNICODER_INVALID_CODE_POINT;
-
-	/* 0xd800 through 0xdfff are reserved for utf-16 surrogates */
-	/* they are not valid unicode code points */
-	if(0xd800 <= decoded  &&  decoded <= 0xdfff)
-		return UNICODER_INVALID_CODE_POINT;
+	if(state == UNICODER_UTF8_REJECT)
+		return UNICODER_INVALID_BYTE_SEQUENCE;
 
 	*result= decoded;
 
-	return numBytes;
+	return i;
 }
 
 
@@ -422,7 +791,6 @@ int unicoder_utf16_encode(unsigned char* p, unsigned int x, unsigned int endiann
 {
 	unsigned int dbyteA, dbyteB, highSurrogate, lowSurrogate, requiredBytes, uPrime;
 	unsigned char temp;
-	const int debug_utf16_encode= 0;
 
 	if(endianness != UNICODER_BES  &&  endianness != UNICODER_LES)
 		return UNICODER_ENDIANNESS_UNRECOGNIZED;
@@ -472,8 +840,6 @@ int unicoder_utf16_encode(unsigned char* p, unsigned int x, unsigned int endiann
 		highSurrogate= 0x0000d800 | ((uPrime >> 10) & 0x000003ff);
 		lowSurrogate=  0x0000dc00 | (uPrime & 0x000003ff);
 
-		if(debug_utf16_encode == 1) printf("\t\ths <%08x>     ls <%08x>     up <%08x>\n", highSurrogate, lowSurrogate, uPrime);
-
 		/* high surrogate always appears first */
 		/* low surrogate always appears second */
 		/* endianness effects how each surrogate is written */
@@ -557,7 +923,6 @@ int unicoder_utf32_encode(unsigned char* p, unsigned int x, unsigned int endiann
 {
 	int i, index;
 	unsigned int temp;
-	const int debug_utf32_encode= 1;
 
 	if(endianness != UNICODER_BES  &&  endianness != UNICODER_LES)
 		return UNICODER_ENDIANNESS_UNRECOGNIZED;
@@ -593,6 +958,89 @@ int unicoder_utf32_encode(unsigned char* p, unsigned int x, unsigned int endiann
 
 
 
+/*
+Single byte code pages.
+
+ISO-8859-1, ISO-8859-15 and windows-1252 give every byte a code point, so reading one is a lookup
+in a 256 entry table that cannot fail. windows-1252 leaves 81, 8D, 8F, 90 and 9D unassigned, and
+like the WHATWG decoder those read as the C1 controls of the same value. Writing goes the other way:
+a code point below 0x100 that the table gives back for its own byte is that byte, and the few that
+moved somewhere else (8 in ISO-8859-15, 27 in windows-1252) are found by binary search in a short
+list sorted by code point. ISO-8859-1 is the first 256 code points as they are and needs neither.
+The tables live in unicoder_codepages.h, which the codecs of unicoder.hpp read as well.
+*/
+
+#include "unicoder_codepages.h"
+
+
+/* what every byte reads as, and the code points that are not their own byte sorted by code point */
+typedef struct
+{
+	const unsigned short* decode;
+	const unicoder_codePageEntry* moved;
+	unsigned int movedCount;
+} unicoder_codePage;
+
+
+static const unicoder_codePage unicoder_iso8859_15Page=
+{
+	unicoder_iso8859_15Decode, unicoder_iso8859_15Moved, sizeof(unicoder_iso8859_15Moved) / sizeof(unicoder_codePageEntry)
+};
+
+static const unicoder_codePage unicoder_cp1252Page=
+{
+	unicoder_cp1252Decode, unicoder_cp1252Moved, sizeof(unicoder_cp1252Moved) / sizeof(unicoder_codePageEntry)
+};
+
+
+/* whether encoding takes one byte per code point */
+UNICODER_INLINE int unicoder_isSingleByte(unsigned int encoding)
+{
+	return encoding == UNICODER_ASCII  ||  encoding >= UNICODER_ISO8859_1;
+}
+
+
+/* the table of a code page with one, NULL for the rest */
+static const unicoder_codePage* unicoder_codePageOf(unsigned int encoding)
+{
+	switch(encoding)
+	{
+		case UNICODER_ISO8859_15: return &unicoder_iso8859_15Page;
+		case UNICODER_CP1252:     return &unicoder_cp1252Page;
+	}
+
+	return NULL;
+}
+
+
+/* byte of x in page, or UNICODER_NOT_IN_CODE_PAGE */
+static int unicoder_codePage_encode(const unicoder_codePage* page, unsigned int x)
+{
+	unsigned int low= 0, high= page->movedCount, middle;
+
+	if(x < 0x100  &&  page->decode[x] == x)
+		return (int) x;
+
+	while(low < high)
+	{
+		middle= (low + high) / 2;
+		if(page->moved[middle].codePoint < x)
+			low= middle + 1;
+		else
+			high= middle;
+	}
+
+	if(low < page->movedCount  &&  page->moved[low].codePoint == x)
+		return page->moved[low].byte;
+
+	return UNICODER_NOT_IN_CODE_PAGE;
+}
+
+
+
+
+
+
 /* reads single code point from p, store in result, returns error code or number of bytes read */
 int unicoder_readCodePoint(unsigned char* p, unsigned int* result, unsigned int encoding)
 {
@@ -601,10 +1049,10 @@ int unicoder_readCodePoint(unsigned char* p, unsigned int* result, unsigned int
 	unsigned int originalPosition, currentChar, bytesRead;
 
 	if(p == NULL)
-		return UNICODER_NULL_POINTER;
+		return UNICODER_STATS_ERROR(UNICODER_NULL_POINTER);
 
 	if(result == NULL)
-		return UNICODER_NULL_POINTER;
+		return UNICODER_STATS_ERROR(UNICODER_NULL_POINTER);
 
 	switch(encoding)
 	{
@@ -633,12 +1081,23 @@ int unicoder_readCodePoint(unsigned char* p, unsigned int* result, unsigned int
 			bytesRead= unicoder_utf32_decode(result, p, UNICODER_LES);
 			break;
 
+		case UNICODER_ISO8859_1:
+			(*result)= (unsigned int) (*p);
+			bytesRead= 1;
+			break;
+
+		case UNICODER_ISO8859_15:
+		case UNICODER_CP1252:
+			(*result)= unicoder_codePageOf(encoding)->decode[*p];
+			bytesRead= 1;
+			break;
+
 		default:
-			return UNICODER_ENCODING_UNRECOGNIZED;
+			return UNICODER_STATS_ERROR(UNICODER_ENCODING_UNRECOGNIZED);
 			break;
 	};
 
-	return bytesRead;
+	return UNICODER_STATS_READ(encoding, (int) bytesRead);
 }
 
 
@@ -686,43 +1145,61 @@ int unicoder_readCodePointFromFile(FILE* f, unsigned int* result, unsigned int e
 /* writes single code point to p, returns number of bytes written or error code */
 int unicoder_writeCodePoint(unsigned char* p, unsigned int x, unsigned int encoding)
 {
+	int byte;
+
 	if(p == NULL)
-		return UNICODER_NULL_POINTER;
+		return UNICODER_STATS_ERROR(UNICODER_NULL_POINTER);
 
 	switch(encoding)
 
 	{
 		case UNICODER_ASCII:
 			if(x > 0x0000007f)
-				return UNICODER_OUT_OF_ASCII_RANGE;
+				return UNICODER_STATS_ERROR(UNICODER_OUT_OF_ASCII_RANGE);
 			(*p)= (unsigned char) x;
-			return 1;
+			return UNICODER_STATS_WRITE(encoding, 1);
 			break;
 
 		case UNICODER_UTF8:
-			return unicoder_utf8_encode(p, x);
+			return UNICODER_STATS_WRITE(encoding, unicoder_utf8_encode(p, x));
 			break;
 
 		case UNICODER_UTF16BE:
-			return unicoder_utf16_encode(p, x, UNICODER_BES);
+			return UNICODER_STATS_WRITE(encoding, unicoder_utf16_encode(p, x, UNICODER_BES));
 			break;
 
 		case UNICODER_UTF16LE:
-			return unicoder_utf16_encode(p, x, UNICODER_LES);
+			return UNICODER_STATS_WRITE(encoding, unicoder_utf16_encode(p, x, UNICODER_LES));
 			break;
 
 
 		case UNICODER_UTF32BE:
-			return unicoder_utf32_encode(p, x, UNICODER_BES);
+			return UNICODER_STATS_WRITE(encoding, unicoder_utf32_encode(p, x, UNICODER_BES));
 			break;
 
 
 		case UNICODER_UTF32LE:
-			return unicoder_utf32_encode(p, x, UNICODER_LES);
+			return UNICODER_STATS_WRITE(encoding, unicoder_utf32_encode(p, x, UNICODER_LES));
+			break;
+
+		case UNICODER_ISO8859_1:
+			if(x > 0x000000ff)
+				return UNICODER_STATS_ERROR(UNICODER_NOT_IN_CODE_PAGE);
+			(*p)= (unsigned char) x;
+			return UNICODER_STATS_WRITE(encoding, 1);
+			break;
+
+		case UNICODER_ISO8859_15:
+		case UNICODER_CP1252:
+			byte= unicoder_codePage_encode(unicoder_codePageOf(encoding), x);
+			if(byte < 0)
+				return UNICODER_STATS_ERROR(byte);
+			(*p)= (unsigned char) byte;
+			return UNICODER_STATS_WRITE(encoding, 1);
 			break;
 
 		default:
-			return UNICODER_ENCODING_UNRECOGNIZED;
+			return UNICODER_STATS_ERROR(UNICODER_ENCODING_UNRECOGNIZED);
 			break;
 	};
 
@@ -735,7 +1212,7 @@ int unicoder_writeCodePoint(unsigned char* p, unsigned int x, unsigned int encod
 int unicoder_writeCodePointToFile(FILE* file, unsigned int x, unsigned int encoding)
 {
 	unsigned char p[4];
-	int i, numBytes, fputcRet;
+	int i, numBytes;
 
 	if(file == NULL)
 		return UNICODER_FILE_IO_ERROR;
@@ -750,27 +1227,40 @@ int unicoder_writeCodePointToFile(FILE* file, unsigned int x, unsigned int encod
 	if(numBytes < 1)
 		return numBytes;
 
-	for(i= 0; i < numBytes; i++)
-	{
-		fputcRet= fputc(p[i], file);
-		if(fputcRet == EOF)
-			return UNICODER_FILE_IO_ERROR;
-	}
+	if(fwrite(p, 1, numBytes, file) != (size_t) numBytes)
+		return UNICODER_FILE_IO_ERROR;
 
 	return numBytes;
 }
 
 
+/* encodes the byte order mark for encoding to p (room for 4 bytes), ascii and the code pages have none */
+static int unicoder_encodeBom(unsigned char* p, unsigned int encoding)
+{
+	if(unicoder_isSingleByte(encoding))
+		return 0;
+
+	return unicoder_writeCodePoint(p, 0x0000feff, encoding);
+}
+
+
 /* writes byte order mark to file f, returns number of bytes written or error code */
 unsigned int unicoder_writeBomToFile(FILE* f, unsigned int encoding)
 {
+	unsigned char p[4];
+	int numBytes;
+
 	if(f == NULL)
 		return UNICODER_FILE_IO_ERROR;
 
-	if(encoding == UNICODER_ASCII)
-		return 0;
+	numBytes= unicoder_encodeBom(p, encoding);
+	if(numBytes < 1)
+		return numBytes;
 
-	return unicoder_writeCodePointToFile(f, 0x0000feff, encoding);
+	if(fwrite(p, 1, numBytes, f) != (size_t) numBytes)
+		return UNICODER_FILE_IO_ERROR;
+
+	return numBytes;
 }
 
 
@@ -785,7 +1275,7 @@ int unicoder_writeCStringToFile(FILE* f, const char* cstr, unsigned int encoding
 	if(cstr == NULL)
 		return UNICODER_NULL_POINTER;
 
-	if(encoding < UNICODER_ASCII  ||  UNICODER_UTF32LE < encoding)
+	if(encoding < UNICODER_ASCII  ||  UNICODER_CP1252 < encoding)
 		return UNICODER_ENCODING_UNRECOGNIZED;
 
 	len= strnlen(cstr, 1000005);
@@ -802,4 +1292,7143 @@ int unicoder_writeCStringToFile(FILE* f, const char* cstr, unsigned int encoding
 
 
 
+/*
+Bulk transcoding.
+
+Every (source, destination) pair gets its own loop built from one read step and one write step.
+The steps take the encoding and endianness as constants, so once they are inlined the loop
+carries no switch on encoding, no endianness test and no NULL checks per code point.
+Unlike the single code point functions above, the read steps never look past the bytes they
+were given.
+*/
+
+
+/* returns length of the leading run of bytes below 0x80 */
+static size_t unicoder_asciiPrefix(const unsigned char* p, size_t len)
+{
+	size_t i= 0;
+	size_t word;
+	const size_t highBits= (((size_t) -1) / 0xff) * 0x80;
+
+	while(i + sizeof(size_t) <= len)
+	{
+		memcpy(&word, p + i, sizeof(size_t));
+		if(word & highBits)
+			break;
+		i += sizeof(size_t);
+	}
+
+	while(i < len  &&  p[i] < 0x80)
+		i++;
+
+	return i;
+}
+
+
+/* read steps: decode one code point from p, which has avail > 0 bytes left */
+/* return number of bytes read or error code, never read past avail */
+
+UNICODER_INLINE int unicoder_ascii_read(const unsigned char* p, size_t avail, unsigned int* cp)
+{
+	(void) avail;
+
+	if(p[0] > 0x7f)
+		return UNICODER_INVALID_BYTE_SEQUENCE;
+
+	*cp= p[0];
+	return 1;
+}
+
+
+/* runs the same state machine as unicoder_utf8_decode, but stops at avail */
+UNICODER_INLINE int unicoder_utf8_read(const unsigned char* p, size_t avail, unsigned int* cp)
+{
+	unsigned int state, type, decoded;
+	size_t i;
+
+	if(p[0] < 0x80)
+	{
+		*cp= p[0];
+		return 1;
+	}
+
+	type= unicoder_utf8Class[p[0]];
+	decoded= (0xff >> type) & p[0];
+	state= unicoder_utf8Transition[type];
+
+	for(i= 1; state > UNICODER_UTF8_REJECT; i++)
+	{
+		if(i == avail)
+			return UNICODER_INCOMPLETE_SEQUENCE;
+
+		type= unicoder_utf8Class[p[i]];
+		decoded= (decoded << 6) | (p[i] & 0x3f);
+		state= unicoder_utf8Transition[state + type];
+	}
+
+	if(state == UNICODER_UTF8_REJECT)
+		return UNICODER_INVALID_BYTE_SEQUENCE;
+
+	*cp= decoded;
+	return (int) i;
+}
+
+
+UNICODER_INLINE unsigned int unicoder_load16(const unsigned char* p, unsigned int endianness)
+{
+	if(endianness == UNICODER_LES)
+		return ((unsigned int) p[1] << 8) | p[0];
+	else
+		return ((unsigned int) p[0] << 8) | p[1];
+}
+
+
+UNICODER_INLINE unsigned int unicoder_load32(const unsigned char* p, unsigned int endianness)
+{
+	if(endianness == UNICODER_LES)
+		return ((unsigned int) p[3] << 24) | ((unsigned int) p[2] << 16) | ((unsigned int) p[1] << 8) | p[0];
+	else
+		return ((unsigned int) p[0] << 24) | ((unsigned int) p[1] << 16) | ((unsigned int) p[2] << 8) | p[3];
+}
+
+
+UNICODER_INLINE void unicoder_store16(unsigned char* p, unsigned int x, unsigned int endianness)
+{
+	if(endianness == UNICODER_LES)
+	{
+		p[0]= (unsigned char) (x & 0xff);
+		p[1]= (unsigned char) ((x >> 8) & 0xff);
+	}
+
+	else
+	{
+		p[0]= (unsigned char) ((x >> 8) & 0xff);
+		p[1]= (unsigned char) (x & 0xff);
+	}
+}
+
+
+UNICODER_INLINE void unicoder_store32(unsigned char* p, unsigned int x, unsigned int endianness)
+{
+	if(endianness == UNICODER_LES)
+	{
+		p[0]= (unsigned char) (x & 0xff);
+		p[1]= (unsigned char) ((x >> 8) & 0xff);
+		p[2]= (unsigned char) ((x >> 16) & 0xff);
+		p[3]= (unsigned char) ((x >> 24) & 0xff);
+	}
+
+	else
+	{
+		p[0]= (unsigned char) ((x >> 24) & 0xff);
+		p[1]= (unsigned char) ((x >> 16) & 0xff);
+		p[2]= (unsigned char) ((x >> 8) & 0xff);
+		p[3]= (unsigned char) (x & 0xff);
+	}
+}
+
+
+UNICODER_INLINE int unicoder_utf16_read(const unsigned char* p, size_t avail, unsigned int* cp, unsigned int endianness)
+{
+	unsigned int dbyteA, dbyteB;
+
+	if(avail < 2)
+		return UNICODER_INCOMPLETE_SEQUENCE;
+
+	dbyteA= unicoder_load16(p, endianness);
+
+	if(dbyteA < 0xd800  ||  0xdfff < dbyteA)
+	{
+		*cp= dbyteA;
+		return 2;
+	}
+
+	/* low surrogate with no high surrogate in front of it */
+	if(dbyteA > 0xdbff)
+		return UNICODER_INVALID_BYTE_SEQUENCE;
+
+	if(avail < 4)
+		return UNICODER_INCOMPLETE_SEQUENCE;
+
+	dbyteB= unicoder_load16(p + 2, endianness);
+	if(dbyteB < 0xdc00  ||  0xdfff < dbyteB)
+		return UNICODER_INVALID_BYTE_SEQUENCE;
+
+	*cp= (((dbyteA & 0x03ff) << 10) | (dbyteB & 0x03ff)) + 0x010000;
+	return 4;
+}
+
+
+UNICODER_INLINE int unicoder_utf32_read(const unsigned char* p, size_t avail, unsigned int* cp, unsigned int endianness)
+{
+	unsigned int decoded;
+
+	if(avail < 4)
+		return UNICODER_INCOMPLETE_SEQUENCE;
+
+	decoded= unicoder_load32(p, endianness);
+
+	if(decoded > 0x10ffff  ||  (0xd800 <= decoded  &&  decoded <= 0xdfff))
+		return UNICODER_INVALID_CODE_POINT;
+
+	*cp= decoded;
+	return 4;
+}
+
+
+UNICODER_INLINE int unicoder_utf16be_read(const unsigned char* p, size_t avail, unsigned int* cp)
+{
+	return unicoder_utf16_read(p, avail, cp, UNICODER_BES);
+}
+
+
+UNICODER_INLINE int unicoder_utf16le_read(const unsigned char* p, size_t avail, unsigned int* cp)
+{
+	return unicoder_utf16_read(p, avail, cp, UNICODER_LES);
+}
+
+
+UNICODER_INLINE int unicoder_utf32be_read(const unsigned char* p, size_t avail, unsigned int* cp)
+{
+	return unicoder_utf32_read(p, avail, cp, UNICODER_BES);
+}
+
+
+UNICODER_INLINE int unicoder_utf32le_read(const unsigned char* p, size_t avail, unsigned int* cp)
+{
+	return unicoder_utf32_read(p, avail, cp, UNICODER_LES);
+}
+
+
+UNICODER_INLINE int unicoder_iso8859_1_read(const unsigned char* p, size_t avail, unsigned int* cp)
+{
+	(void) avail;
+
+	*cp= p[0];
+	return 1;
+}
+
+
+UNICODER_INLINE int unicoder_iso8859_15_read(const unsigned char* p, size_t avail, unsigned int* cp)
+{
+	(void) avail;
+
+	*cp= unicoder_iso8859_15Decode[p[0]];
+	return 1;
+}
+
+
+UNICODER_INLINE int unicoder_cp1252_read(const unsigned char* p, size_t avail, unsigned int* cp)
+{
+	(void) avail;
+
+	*cp= unicoder_cp1252Decode[p[0]];
+	return 1;
+}
+
+
+/* write steps: encode x, which the read steps guarantee is a valid code point, to p */
+/* return number of bytes written or error code, never write past avail */
+
+UNICODER_INLINE int unicoder_ascii_write(unsigned char* p, size_t avail, unsigned int x)
+{
+	if(x > 0x7f)
+		return UNICODER_OUT_OF_ASCII_RANGE;
+
+	if(avail < 1)
+		return UNICODER_OUTPUT_BUFFER_FULL;
+
+	p[0]= (unsigned char) x;
+	return 1;
+}
+
+
+UNICODER_INLINE int unicoder_utf8_write(unsigned char* p, size_t avail, unsigned int x)
+{
+	if(x < 0x80)
+	{
+		if(avail < 1)
+			return UNICODER_OUTPUT_BUFFER_FULL;
+
+		p[0]= (unsigned char) x;
+		return 1;
+	}
+
+	if(x < 0x0800)
+	{
+		if(avail < 2)
+			return UNICODER_OUTPUT_BUFFER_FULL;
+
+		p[0]= (unsigned char) (0xc0 | (x >> 6));
+		p[1]= (unsigned char) (0x80 | (x & 0x3f));
+		return 2;
+	}
+
+	if(x < 0x010000)
+	{
+		if(avail < 3)
+			return UNICODER_OUTPUT_BUFFER_FULL;
+
+		p[0]= (unsigned char) (0xe0 | (x >> 12));
+		p[1]= (unsigned char) (0x80 | ((x >> 6) & 0x3f));
+		p[2]= (unsigned char) (0x80 | (x & 0x3f));
+		return 3;
+	}
+
+	if(avail < 4)
+		return UNICODER_OUTPUT_BUFFER_FULL;
+
+	p[0]= (unsigned char) (0xf0 | (x >> 18));
+	p[1]= (unsigned char) (0x80 | ((x >> 12) & 0x3f));
+	p[2]= (unsigned char) (0x80 | ((x >> 6) & 0x3f));
+	p[3]= (unsigned char) (0x80 | (x & 0x3f));
+	return 4;
+}
+
+
+UNICODER_INLINE int unicoder_utf16_write(unsigned char* p, size_t avail, unsigned int x, unsigned int endianness)
+{
+	unsigned int uPrime;
+
+	if(x < 0x010000)
+	{
+		if(avail < 2)
+			return UNICODER_OUTPUT_BUFFER_FULL;
+
+		unicoder_store16(p, x, endianness);
+		return 2;
+	}
+
+	if(avail < 4)
+		return UNICODER_OUTPUT_BUFFER_FULL;
+
+	/* high surrogate always appears first */
+	uPrime= x - 0x010000;
+	unicoder_store16(p, 0xd800 | (uPrime >> 10), endianness);
+	unicoder_store16(p + 2, 0xdc00 | (uPrime & 0x03ff), endianness);
+	return 4;
+}
+
+
+UNICODER_INLINE int unicoder_utf32_write(unsigned char* p, size_t avail, unsigned int x, unsigned int endianness)
+{
+	if(avail < 4)
+		return UNICODER_OUTPUT_BUFFER_FULL;
+
+	unicoder_store32(p, x, endianness);
+	return 4;
+}
+
+
+UNICODER_INLINE int unicoder_utf16be_write(unsigned char* p, size_t avail, unsigned int x)
+{
+	return unicoder_utf16_write(p, avail, x, UNICODER_BES);
+}
+
+
+UNICODER_INLINE int unicoder_utf16le_write(unsigned char* p, size_t avail, unsigned int x)
+{
+	return unicoder_utf16_write(p, avail, x, UNICODER_LES);
+}
+
+
+UNICODER_INLINE int unicoder_utf32be_write(unsigned char* p, size_t avail, unsigned int x)
+{
+	return unicoder_utf32_write(p, avail, x, UNICODER_BES);
+}
+
+
+UNICODER_INLINE int unicoder_utf32le_write(unsigned char* p, size_t avail, unsigned int x)
+{
+	return unicoder_utf32_write(p, avail, x, UNICODER_LES);
+}
+
+
+UNICODER_INLINE int unicoder_iso8859_1_write(unsigned char* p, size_t avail, unsigned int x)
+{
+	if(x > 0xff)
+		return UNICODER_NOT_IN_CODE_PAGE;
+
+	if(avail < 1)
+		return UNICODER_OUTPUT_BUFFER_FULL;
+
+	p[0]= (unsigned char) x;
+	return 1;
+}
+
+
+UNICODER_INLINE int unicoder_codePage_write(unsigned char* p, size_t avail, unsigned int x, const unicoder_codePage* page)
+{
+	int byte;
+
+	byte= unicoder_codePage_encode(page, x);
+	if(byte < 0)
+		return byte;
+
+	if(avail < 1)
+		return UNICODER_OUTPUT_BUFFER_FULL;
+
+	p[0]= (unsigned char) byte;
+	return 1;
+}
+
+
+UNICODER_INLINE int unicoder_iso8859_15_write(unsigned char* p, size_t avail, unsigned int x)
+{
+	return unicoder_codePage_write(p, avail, x, &unicoder_iso8859_15Page);
+}
+
+
+UNICODER_INLINE int unicoder_cp1252_write(unsigned char* p, size_t avail, unsigned int x)
+{
+	return unicoder_codePage_write(p, avail, x, &unicoder_cp1252Page);
+}
+
+
+/* every pair kernel has this shape, returns 0 or error code and always reports its progress */
+typedef int (*unicoder_transcoder)(const unsigned char* src, size_t srcLen,
+                                   unsigned char* dst, size_t dstCap,
+                                   size_t* consumed, size_t* produced);
+
+
+/* the kernels of one cpu tier, see CPU dispatch at the end of the file */
+/* the counting, swapping, skipping and folding kernels return how many leading bytes they took care of, NULL means none */
+typedef struct
+{
+	unsigned int tier;
+	size_t (*utf8FindErrorBlock)(const unsigned char* buf, size_t len);
+	unicoder_transcoder utf8ToUtf16be, utf8ToUtf16le, utf16beToUtf8, utf16leToUtf8;
+	unicoder_transcoder utf16beToUtf16le, utf16leToUtf16be, utf32beToUtf32le, utf32leToUtf32be;
+	unicoder_transcoder utf16beToUtf16be, utf16leToUtf16le, utf32beToUtf32be, utf32leToUtf32le;
+	unicoder_transcoder latin1ToUtf8, utf8ToLatin1;
+	size_t (*utf8CountLeads)(const unsigned char* p, size_t len, size_t* leads, size_t* longLeads);
+	size_t (*countZeros)(const unsigned char* p, size_t len, size_t zeros[4]);
+	size_t (*swapBytes)(const unsigned char* src, unsigned char* dst, size_t len, unsigned int unitSize);
+	size_t (*skipBelow)(const unsigned char* p, size_t len, unsigned char limit);
+	size_t (*asciiFold)(const unsigned char* src, unsigned char* dst, size_t len);
+	size_t (*utf8Fold)(const unsigned char* src, unsigned char* dst, size_t len);
+	size_t (*utf8SkipLeads)(const unsigned char* p, size_t len, size_t* n);
+	size_t (*utf16Skip)(const unsigned char* p, size_t len, unsigned int endianness, size_t* n);
+	size_t (*findUnit)(const unsigned char* p, size_t len, const unsigned char* unit, unsigned int unitSize);
+} unicoder_kernelSet;
+
+static const unicoder_kernelSet* unicoder_kernels(void);
+
+
+/* stamps out the generic loop for one pair */
+#define  UNICODER_DEFINE_TRANSCODER(name, readStep, writeStep)                         \
+static int name(const unsigned char* src, size_t srcLen,                               \
+                unsigned char* dst, size_t dstCap,                                     \
+                size_t* consumed, size_t* produced)                                    \
+{                                                                                      \
+	size_t in= 0, out= 0;                                                              \
+	int bytesRead, bytesWritten, ret= 0;                                               \
+	unsigned int x;                                                                    \
+                                                                                       \
+	while(in < srcLen)                                                                 \
+	{                                                                                  \
+		bytesRead= readStep(src + in, srcLen - in, &x);                                \
+		if(bytesRead < 0)                                                              \
+		{                                                                              \
+			ret= bytesRead;                                                            \
+			break;                                                                     \
+		}                                                                              \
+                                                                                       \
+		bytesWritten= writeStep(dst + out, dstCap - out, x);                           \
+		if(bytesWritten < 0)                                                           \
+		{                                                                              \
+			ret= bytesWritten;                                                         \
+			break;                                                                     \
+		}                                                                              \
+                                                                                       \
+		in += bytesRead;                                                               \
+		out += bytesWritten;                                                           \
+	}                                                                                  \
+                                                                                       \
+	*consumed= in;                                                                     \
+	*produced= out;                                                                    \
+	return ret;                                                                        \
+}
+
+/* length of the leading run of bytes below limit, the vector kernels first */
+static size_t unicoder_skipBelow(const unsigned char* p, size_t len, unsigned char limit)
+{
+	size_t i= 0;
+
+	if(unicoder_kernels()->skipBelow != NULL)
+		i= unicoder_kernels()->skipBelow(p, len, limit);
+
+	while(i < len  &&  p[i] < limit)
+	{
+		i++;
+		i += unicoder_asciiPrefix(p + i, len - i);
+	}
+
+	return i;
+}
+
+
+/* ascii out of utf-8 is the leading ascii run copied as is; the sequence that ends it decides the error */
+static int unicoder_transcode_utf8_ascii(const unsigned char* src, size_t srcLen,
+                                         unsigned char* dst, size_t dstCap,
+                                         size_t* consumed, size_t* produced)
+{
+	size_t in;
+	int bytesRead, ret= 0;
+	unsigned int x;
+
+	in= unicoder_skipBelow(src, (srcLen < dstCap) ? srcLen : dstCap, 0x80);
+	memcpy(dst, src, in);
+
+	if(in < srcLen)
+	{
+		bytesRead= unicoder_utf8_read(src + in, srcLen - in, &x);
+
+		if(bytesRead < 0)
+			ret= bytesRead;
+		else
+			ret= (x > 0x7f) ? UNICODER_OUT_OF_ASCII_RANGE : UNICODER_OUTPUT_BUFFER_FULL;
+	}
+
+	*consumed= in;
+	*produced= in;
+	return ret;
+}
+
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf8_utf32be,   unicoder_utf8_read,    unicoder_utf32be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf8_utf32le,   unicoder_utf8_read,    unicoder_utf32le_write)
+
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_ascii_utf16be,  unicoder_ascii_read,   unicoder_utf16be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_ascii_utf16le,  unicoder_ascii_read,   unicoder_utf16le_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_ascii_utf32be,  unicoder_ascii_read,   unicoder_utf32be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_ascii_utf32le,  unicoder_ascii_read,   unicoder_utf32le_write)
+
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf16be_ascii,   unicoder_utf16be_read, unicoder_ascii_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf16be_utf32be, unicoder_utf16be_read, unicoder_utf32be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf16be_utf32le, unicoder_utf16be_read, unicoder_utf32le_write)
+
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf16le_ascii,   unicoder_utf16le_read, unicoder_ascii_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf16le_utf32be, unicoder_utf16le_read, unicoder_utf32be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf16le_utf32le, unicoder_utf16le_read, unicoder_utf32le_write)
+
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf32be_ascii,   unicoder_utf32be_read, unicoder_ascii_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf32be_utf8,    unicoder_utf32be_read, unicoder_utf8_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf32be_utf16be, unicoder_utf32be_read, unicoder_utf16be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf32be_utf16le, unicoder_utf32be_read, unicoder_utf16le_write)
+
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf32le_ascii,   unicoder_utf32le_read, unicoder_ascii_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf32le_utf8,    unicoder_utf32le_read, unicoder_utf8_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf32le_utf16be, unicoder_utf32le_read, unicoder_utf16be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf32le_utf16le, unicoder_utf32le_read, unicoder_utf16le_write)
+
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf8_iso8859_15,    unicoder_utf8_read,    unicoder_iso8859_15_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf8_cp1252,        unicoder_utf8_read,    unicoder_cp1252_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf16be_iso8859_1,  unicoder_utf16be_read, unicoder_iso8859_1_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf16be_iso8859_15, unicoder_utf16be_read, unicoder_iso8859_15_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf16be_cp1252,     unicoder_utf16be_read, unicoder_cp1252_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf16le_iso8859_1,  unicoder_utf16le_read, unicoder_iso8859_1_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf16le_iso8859_15, unicoder_utf16le_read, unicoder_iso8859_15_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf16le_cp1252,     unicoder_utf16le_read, unicoder_cp1252_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf32be_iso8859_1,  unicoder_utf32be_read, unicoder_iso8859_1_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf32be_iso8859_15, unicoder_utf32be_read, unicoder_iso8859_15_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf32be_cp1252,     unicoder_utf32be_read, unicoder_cp1252_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf32le_iso8859_1,  unicoder_utf32le_read, unicoder_iso8859_1_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf32le_iso8859_15, unicoder_utf32le_read, unicoder_iso8859_15_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_utf32le_cp1252,     unicoder_utf32le_read, unicoder_cp1252_write)
+
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_1_ascii,      unicoder_iso8859_1_read, unicoder_ascii_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_1_utf16be,    unicoder_iso8859_1_read, unicoder_utf16be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_1_utf16le,    unicoder_iso8859_1_read, unicoder_utf16le_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_1_utf32be,    unicoder_iso8859_1_read, unicoder_utf32be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_1_utf32le,    unicoder_iso8859_1_read, unicoder_utf32le_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_1_iso8859_15, unicoder_iso8859_1_read, unicoder_iso8859_15_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_1_cp1252,     unicoder_iso8859_1_read, unicoder_cp1252_write)
+
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_15_ascii,     unicoder_iso8859_15_read, unicoder_ascii_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_15_utf8,      unicoder_iso8859_15_read, unicoder_utf8_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_15_utf16be,   unicoder_iso8859_15_read, unicoder_utf16be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_15_utf16le,   unicoder_iso8859_15_read, unicoder_utf16le_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_15_utf32be,   unicoder_iso8859_15_read, unicoder_utf32be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_15_utf32le,   unicoder_iso8859_15_read, unicoder_utf32le_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_15_iso8859_1, unicoder_iso8859_15_read, unicoder_iso8859_1_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_iso8859_15_cp1252,    unicoder_iso8859_15_read, unicoder_cp1252_write)
+
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_cp1252_ascii,      unicoder_cp1252_read, unicoder_ascii_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_cp1252_utf8,       unicoder_cp1252_read, unicoder_utf8_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_cp1252_utf16be,    unicoder_cp1252_read, unicoder_utf16be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_cp1252_utf16le,    unicoder_cp1252_read, unicoder_utf16le_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_cp1252_utf32be,    unicoder_cp1252_read, unicoder_utf32be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_cp1252_utf32le,    unicoder_cp1252_read, unicoder_utf32le_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_cp1252_iso8859_1,  unicoder_cp1252_read, unicoder_iso8859_1_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_transcode_cp1252_iso8859_15, unicoder_cp1252_read, unicoder_iso8859_15_write)
+
+/* pairs with vector kernels, these loops are the scalar tier's */
+UNICODER_DEFINE_TRANSCODER(unicoder_scalar_transcode_utf8_utf16be,    unicoder_utf8_read,      unicoder_utf16be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_scalar_transcode_utf8_utf16le,    unicoder_utf8_read,      unicoder_utf16le_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_scalar_transcode_utf16be_utf8,    unicoder_utf16be_read,   unicoder_utf8_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_scalar_transcode_utf16le_utf8,    unicoder_utf16le_read,   unicoder_utf8_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_scalar_transcode_utf16be_utf16le, unicoder_utf16be_read,   unicoder_utf16le_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_scalar_transcode_utf16le_utf16be, unicoder_utf16le_read,   unicoder_utf16be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_scalar_transcode_utf32be_utf32le, unicoder_utf32be_read,   unicoder_utf32le_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_scalar_transcode_utf32le_utf32be, unicoder_utf32le_read,   unicoder_utf32be_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_scalar_transcode_iso8859_1_utf8,  unicoder_iso8859_1_read, unicoder_utf8_write)
+UNICODER_DEFINE_TRANSCODER(unicoder_scalar_transcode_utf8_iso8859_1,  unicoder_utf8_read,      unicoder_iso8859_1_write)
+
+
+/* stamps out the loop for a pair whose bytes pass through unchanged once they are known to be valid */
+#define  UNICODER_DEFINE_COPY_TRANSCODER(name, readStep, byteOriented)                 \
+static int name(const unsigned char* src, size_t srcLen,                               \
+                unsigned char* dst, size_t dstCap,                                     \
+                size_t* consumed, size_t* produced)                                    \
+{                                                                                      \
+	size_t in= 0, limit;                                                               \
+	int bytesRead, ret= 0;                                                             \
+	unsigned int x;                                                                    \
+                                                                                       \
+	limit= (srcLen < dstCap) ? srcLen : dstCap;                                        \
+                                                                                       \
+	while(in < limit)                                                                  \
+	{                                                                                  \
+		if(byteOriented  &&  src[in] < 0x80)                                           \
+		{                                                                              \
+			in += unicoder_asciiPrefix(src + in, limit - in);                          \
+			continue;                                                                  \
+		}                                                                              \
+                                                                                       \
+		bytesRead= readStep(src + in, limit - in, &x);                                 \
+		if(bytesRead < 0)                                                              \
+		{                                                                              \
+			ret= bytesRead;                                                            \
+			break;                                                                     \
+		}                                                                              \
+                                                                                       \
+		in += bytesRead;                                                               \
+	}                                                                                  \
+                                                                                       \
+	/* stopping at dstCap looks like a truncated sequence, decide with the full source */ \
+	if(in < srcLen  &&  limit < srcLen                                                 \
+	                &&  (ret == 0  ||  ret == UNICODER_INCOMPLETE_SEQUENCE))           \
+	{                                                                                  \
+		bytesRead= readStep(src + in, srcLen - in, &x);                                \
+		ret= (bytesRead < 0) ? bytesRead : UNICODER_OUTPUT_BUFFER_FULL;                \
+	}                                                                                  \
+                                                                                       \
+	memcpy(dst, src, in);                                                              \
+	*consumed= in;                                                                     \
+	*produced= in;                                                                     \
+	return ret;                                                                        \
+}
+
+UNICODER_DEFINE_COPY_TRANSCODER(unicoder_transcode_ascii_ascii,     unicoder_ascii_read,   1)
+UNICODER_DEFINE_COPY_TRANSCODER(unicoder_transcode_ascii_utf8,      unicoder_ascii_read,   1)
+
+/* the vector tiers check these in registers along with the byte order swaps */
+UNICODER_DEFINE_COPY_TRANSCODER(unicoder_scalar_transcode_utf16be_utf16be, unicoder_utf16be_read, 0)
+UNICODER_DEFINE_COPY_TRANSCODER(unicoder_scalar_transcode_utf16le_utf16le, unicoder_utf16le_read, 0)
+UNICODER_DEFINE_COPY_TRANSCODER(unicoder_scalar_transcode_utf32be_utf32be, unicoder_utf32be_read, 0)
+UNICODER_DEFINE_COPY_TRANSCODER(unicoder_scalar_transcode_utf32le_utf32le, unicoder_utf32le_read, 0)
+
+/* ascii is the bottom half of every code page, and a code page copied onto itself needs no checking */
+UNICODER_DEFINE_COPY_TRANSCODER(unicoder_transcode_ascii_iso8859_1,       unicoder_ascii_read,      1)
+UNICODER_DEFINE_COPY_TRANSCODER(unicoder_transcode_ascii_iso8859_15,      unicoder_ascii_read,      1)
+UNICODER_DEFINE_COPY_TRANSCODER(unicoder_transcode_ascii_cp1252,          unicoder_ascii_read,      1)
+UNICODER_DEFINE_COPY_TRANSCODER(unicoder_transcode_iso8859_1_iso8859_1,   unicoder_iso8859_1_read,  1)
+UNICODER_DEFINE_COPY_TRANSCODER(unicoder_transcode_iso8859_15_iso8859_15, unicoder_iso8859_15_read, 1)
+UNICODER_DEFINE_COPY_TRANSCODER(unicoder_transcode_cp1252_cp1252,         unicoder_cp1252_read,     1)
+
+
+/*
+utf-8 validation.
+
+The vector paths use Keiser and Lemire's lookup method: three 16 entry nibble tables, indexed by
+the high and low nibble of the previous byte and the high nibble of the current one, are ANDed
+together so that any set bit names a bad pair of adjacent bytes. A second check makes sure the
+third and fourth bytes of 3 and 4 byte sequences are continuations. Together these reject the
+same things unicoder_utf8_read does, overlongs included.
+
+The vector paths only find the 64 byte block where things go wrong, the scalar loop then
+re-reads from the last lead byte before that block to get the exact offset and error code.
+*/
+
+#define  UNICODER_U8_TOO_SHORT       0x01 /* lead or ascii followed by a lead or ascii where a continuation belongs */
+#define  UNICODER_U8_TOO_LONG        0x02 /* ascii followed by a continuation */
+#define  UNICODER_U8_OVERLONG_3      0x04 /* E0 80..9F */
+#define  UNICODER_U8_TOO_LARGE       0x08 /* F4 90..BF and anything from F5 up */
+#define  UNICODER_U8_SURROGATE       0x10 /* ED A0..BF */
+#define  UNICODER_U8_OVERLONG_2      0x20 /* C0 and C1 */
+#define  UNICODER_U8_TOO_LARGE_1000  0x40 /* F5..FF 80..8F */
+#define  UNICODER_U8_OVERLONG_4      0x40 /* F0 80..8F */
+#define  UNICODER_U8_TWO_CONTS       0x80 /* continuation followed by continuation */
+#define  UNICODER_U8_CARRY           (UNICODER_U8_TOO_SHORT | UNICODER_U8_TOO_LONG | UNICODER_U8_TWO_CONTS)
+
+#define  UNICODER_U8_BYTE_1_HIGH                                                                \
+	(char) UNICODER_U8_TOO_LONG, (char) UNICODER_U8_TOO_LONG, (char) UNICODER_U8_TOO_LONG, (char) UNICODER_U8_TOO_LONG, \
+	(char) UNICODER_U8_TOO_LONG, (char) UNICODER_U8_TOO_LONG, (char) UNICODER_U8_TOO_LONG, (char) UNICODER_U8_TOO_LONG, \
+	(char) UNICODER_U8_TWO_CONTS, (char) UNICODER_U8_TWO_CONTS, (char) UNICODER_U8_TWO_CONTS, (char) UNICODER_U8_TWO_CONTS, \
+	(char) (UNICODER_U8_TOO_SHORT | UNICODER_U8_OVERLONG_2),                                    \
+	(char) UNICODER_U8_TOO_SHORT,                                                               \
+	(char) (UNICODER_U8_TOO_SHORT | UNICODER_U8_OVERLONG_3 | UNICODER_U8_SURROGATE),            \
+	(char) (UNICODER_U8_TOO_SHORT | UNICODER_U8_TOO_LARGE | UNICODER_U8_TOO_LARGE_1000 | UNICODER_U8_OVERLONG_4)
+
+#define  UNICODER_U8_BYTE_1_LOW                                                                 \
+	(char) (UNICODER_U8_CARRY | UNICODER_U8_OVERLONG_3 | UNICODER_U8_OVERLONG_2 | UNICODER_U8_OVERLONG_4), \
+	(char) (UNICODER_U8_CARRY | UNICODER_U8_OVERLONG_2),                                        \
+	(char) UNICODER_U8_CARRY,                                                                   \
+	(char) UNICODER_U8_CARRY,                                                                   \
+	(char) (UNICODER_U8_CARRY | UNICODER_U8_TOO_LARGE),                                         \
+	(char) (UNICODER_U8_CARRY | UNICODER_U8_TOO_LARGE | UNICODER_U8_TOO_LARGE_1000),            \
+	(char) (UNICODER_U8_CARRY | UNICODER_U8_TOO_LARGE | UNICODER_U8_TOO_LARGE_1000),            \
+	(char) (UNICODER_U8_CARRY | UNICODER_U8_TOO_LARGE | UNICODER_U8_TOO_LARGE_1000),            \
+	(char) (UNICODER_U8_CARRY | UNICODER_U8_TOO_LARGE | UNICODER_U8_TOO_LARGE_1000),            \
+	(char) (UNICODER_U8_CARRY | UNICODER_U8_TOO_LARGE | UNICODER_U8_TOO_LARGE_1000),            \
+	(char) (UNICODER_U8_CARRY | UNICODER_U8_TOO_LARGE | UNICODER_U8_TOO_LARGE_1000),            \
+	(char) (UNICODER_U8_CARRY | UNICODER_U8_TOO_LARGE | UNICODER_U8_TOO_LARGE_1000),            \
+	(char) (UNICODER_U8_CARRY | UNICODER_U8_TOO_LARGE | UNICODER_U8_TOO_LARGE_1000),            \
+	(char) (UNICODER_U8_CARRY | UNICODER_U8_TOO_LARGE | UNICODER_U8_TOO_LARGE_1000 | UNICODER_U8_SURROGATE), \
+	(char) (UNICODER_U8_CARRY | UNICODER_U8_TOO_LARGE | UNICODER_U8_TOO_LARGE_1000),            \
+	(char) (UNICODER_U8_CARRY | UNICODER_U8_TOO_LARGE | UNICODER_U8_TOO_LARGE_1000)
+
+#define  UNICODER_U8_BYTE_2_HIGH                                                                \
+	(char) UNICODER_U8_TOO_SHORT, (char) UNICODER_U8_TOO_SHORT, (char) UNICODER_U8_TOO_SHORT, (char) UNICODER_U8_TOO_SHORT, \
+	(char) UNICODER_U8_TOO_SHORT, (char) UNICODER_U8_TOO_SHORT, (char) UNICODER_U8_TOO_SHORT, (char) UNICODER_U8_TOO_SHORT, \
+	(char) (UNICODER_U8_TOO_LONG | UNICODER_U8_OVERLONG_2 | UNICODER_U8_TWO_CONTS | UNICODER_U8_OVERLONG_3 | UNICODER_U8_TOO_LARGE_1000 | UNICODER_U8_OVERLONG_4), \
+	(char) (UNICODER_U8_TOO_LONG | UNICODER_U8_OVERLONG_2 | UNICODER_U8_TWO_CONTS | UNICODER_U8_OVERLONG_3 | UNICODER_U8_TOO_LARGE), \
+	(char) (UNICODER_U8_TOO_LONG | UNICODER_U8_OVERLONG_2 | UNICODER_U8_TWO_CONTS | UNICODER_U8_SURROGATE | UNICODER_U8_TOO_LARGE), \
+	(char) (UNICODER_U8_TOO_LONG | UNICODER_U8_OVERLONG_2 | UNICODER_U8_TWO_CONTS | UNICODER_U8_SURROGATE | UNICODER_U8_TOO_LARGE), \
+	(char) UNICODER_U8_TOO_SHORT, (char) UNICODER_U8_TOO_SHORT, (char) UNICODER_U8_TOO_SHORT, (char) UNICODER_U8_TOO_SHORT
+
+/* the last three bytes of a block may not start a sequence that needs more bytes than are left */
+#define  UNICODER_U8_INCOMPLETE_MAX                                                             \
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char) (0xf0 - 1), (char) (0xe0 - 1), (char) (0xc0 - 1)
+
+
+/* blocks before this one checked out, so back up to the lead byte of any sequence spilling into it */
+static size_t unicoder_utf8_rewind(const unsigned char* buf, size_t blockStart)
+{
+	size_t i;
+
+	for(i= 1; i <= 3  &&  i <= blockStart; i++)
+	{
+		if((buf[blockStart - i] & 0xc0) != 0x80)
+			return blockStart - i;
+	}
+
+	return blockStart;
+}
+
+
+/* plain loop used when there are no vector units, and to pin down errors the vector paths find */
+static int unicoder_utf8_validateScalar(const unsigned char* buf, size_t len, size_t* errorOffset)
+{
+	size_t i, end, blockStart= 0, start;
+	unsigned long long state= UNICODER_UTF8_ROW_ACCEPT;
+
+	/* first pass only runs the packed machine, checking for trouble once per block */
+	for(i= 0; i < len; )
+	{
+		/* ascii runs between code points skip the state machine a word at a time */
+		if(state == UNICODER_UTF8_ROW_ACCEPT)
+		{
+			i += unicoder_asciiPrefix(buf + i, len - i);
+			if(i == len)
+				break;
+		}
+
+		blockStart= i;
+		end= (len - i > 64) ? i + 64 : len;
+
+		for(; i < end; i++)
+			state= unicoder_utf8Rows[buf[i]] >> (state & 63);
+
+		state &= 63;
+		if(state == UNICODER_UTF8_ROW_REJECT)
+			break;
+	}
+
+	if(state == UNICODER_UTF8_ROW_ACCEPT)
+	{
+		*errorOffset= len;
+		return 0;
+	}
+
+	/* something is wrong in the last block, walk it again keeping track of where each code point starts */
+	start= unicoder_utf8_rewind(buf, blockStart);
+	state= UNICODER_UTF8_ACCEPT;
+
+	for(i= start; i < len; i++)
+	{
+		state= unicoder_utf8Transition[state + unicoder_utf8Class[buf[i]]];
+
+		if(state == UNICODER_UTF8_ACCEPT)
+			start= i + 1;
+		else if(state == UNICODER_UTF8_REJECT)
+			break;
+	}
+
+	*errorOffset= start;
+
+	if(state == UNICODER_UTF8_REJECT)
+		return UNICODER_INVALID_BYTE_SEQUENCE;
+
+	return UNICODER_INCOMPLETE_SEQUENCE;
+}
+
+
+#if defined(UNICODER_SSE)
+
+UNICODER_INLINE UNICODER_TARGET_SSE __m128i unicoder_sse_utf8Check(__m128i input, __m128i prevInput)
+{
+	__m128i prev1, prev2, prev3, byte1High, byte1Low, byte2High, special, must23;
+	const __m128i nibble= _mm_set1_epi8(0x0f);
+
+	prev1= _mm_alignr_epi8(input, prevInput, 15);
+	prev2= _mm_alignr_epi8(input, prevInput, 14);
+	prev3= _mm_alignr_epi8(input, prevInput, 13);
+
+	byte1High= _mm_shuffle_epi8(_mm_setr_epi8(UNICODER_U8_BYTE_1_HIGH),
+	                            _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+	byte1Low=  _mm_shuffle_epi8(_mm_setr_epi8(UNICODER_U8_BYTE_1_LOW),
+	                            _mm_and_si128(prev1, nibble));
+	byte2High= _mm_shuffle_epi8(_mm_setr_epi8(UNICODER_U8_BYTE_2_HIGH),
+	                            _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+
+	special= _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+
+	/* bytes two and three past a 3 or 4 byte lead must be continuations, and nothing else may be */
+	must23= _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8((char) (0xe0 - 0x80))),
+	                     _mm_subs_epu8(prev3, _mm_set1_epi8((char) (0xf0 - 0x80))));
+
+	return _mm_xor_si128(_mm_and_si128(must23, _mm_set1_epi8((char) 0x80)), special);
+}
+
+
+/* returns start of the first 64 byte block that holds an error, or len if there is none */
+static UNICODER_TARGET_SSE size_t unicoder_sse_utf8FindErrorBlock(const unsigned char* buf, size_t len)
+{
+	size_t i;
+	unsigned char padded[64];
+	const unsigned char* block;
+	__m128i in0, in1, in2, in3, error, prevInput, prevIncomplete;
+
+	prevInput= _mm_setzero_si128();
+	prevIncomplete= _mm_setzero_si128();
+
+	for(i= 0; i < len; i += 64)
+	{
+		block= buf + i;
+
+		/* the last partial block is padded with ascii, which flags anything left unfinished */
+		if(len - i < 64)
+		{
+			memset(padded, 0, 64);
+			memcpy(padded, buf + i, len - i);
+			block= padded;
+		}
+
+		in0= _mm_loadu_si128((const __m128i*) (block));
+		in1= _mm_loadu_si128((const __m128i*) (block + 16));
+		in2= _mm_loadu_si128((const __m128i*) (block + 32));
+		in3= _mm_loadu_si128((const __m128i*) (block + 48));
+
+		if(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(in0, in1), _mm_or_si128(in2, in3))) == 0)
+		{
+			error= prevIncomplete;
+			prevIncomplete= _mm_setzero_si128();
+		}
+
+		else
+		{
+			error= unicoder_sse_utf8Check(in0, prevInput);
+			error= _mm_or_si128(error, unicoder_sse_utf8Check(in1, in0));
+			error= _mm_or_si128(error, unicoder_sse_utf8Check(in2, in1));
+			error= _mm_or_si128(error, unicoder_sse_utf8Check(in3, in2));
+			prevIncomplete= _mm_subs_epu8(in3, _mm_setr_epi8(UNICODER_U8_INCOMPLETE_MAX));
+		}
+
+		if(!_mm_testz_si128(error, error))
+			return i;
+
+		prevInput= in3;
+	}
+
+	/* a whole last block can still end in the middle of a sequence */
+	if(!_mm_testz_si128(prevIncomplete, prevIncomplete))
+		return i - 64;
+
+	return len;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX2)
+
+UNICODER_INLINE UNICODER_TARGET_AVX2 __m256i unicoder_avx2_utf8Check(__m256i input, __m256i prevInput)
+{
+	__m256i carried, prev1, prev2, prev3, byte1High, byte1Low, byte2High, special, must23;
+	const __m256i nibble= _mm256_set1_epi8(0x0f);
+
+	/* alignr works within 128 bit lanes, so feed it the previous lane first */
+	carried= _mm256_permute2x128_si256(prevInput, input, 0x21);
+	prev1= _mm256_alignr_epi8(input, carried, 15);
+	prev2= _mm256_alignr_epi8(input, carried, 14);
+	prev3= _mm256_alignr_epi8(input, carried, 13);
+
+	byte1High= _mm256_shuffle_epi8(_mm256_setr_epi8(UNICODER_U8_BYTE_1_HIGH, UNICODER_U8_BYTE_1_HIGH),
+	                               _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+	byte1Low=  _mm256_shuffle_epi8(_mm256_setr_epi8(UNICODER_U8_BYTE_1_LOW, UNICODER_U8_BYTE_1_LOW),
+	                               _mm256_and_si256(prev1, nibble));
+	byte2High= _mm256_shuffle_epi8(_mm256_setr_epi8(UNICODER_U8_BYTE_2_HIGH, UNICODER_U8_BYTE_2_HIGH),
+	                               _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+
+	special= _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+
+	must23= _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8((char) (0xe0 - 0x80))),
+	                        _mm256_subs_epu8(prev3, _mm256_set1_epi8((char) (0xf0 - 0x80))));
+
+	return _mm256_xor_si256(_mm256_and_si256(must23, _mm256_set1_epi8((char) 0x80)), special);
+}
+
+
+/* returns start of the first 64 byte block that holds an error, or len if there is none */
+static UNICODER_TARGET_AVX2 size_t unicoder_avx2_utf8FindErrorBlock(const unsigned char* buf, size_t len)
+{
+	size_t i;
+	unsigned char padded[64];
+	const unsigned char* block;
+	__m256i in0, in1, error, prevInput, prevIncomplete;
+	const __m256i incompleteMax= _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	                                              UNICODER_U8_INCOMPLETE_MAX);
+
+	prevInput= _mm256_setzero_si256();
+	prevIncomplete= _mm256_setzero_si256();
+
+	for(i= 0; i < len; i += 64)
+	{
+		block= buf + i;
+
+		if(len - i < 64)
+		{
+			memset(padded, 0, 64);
+			memcpy(padded, buf + i, len - i);
+			block= padded;
+		}
+
+		in0= _mm256_loadu_si256((const __m256i*) (block));
+		in1= _mm256_loadu_si256((const __m256i*) (block + 32));
+
+		if(_mm256_movemask_epi8(_mm256_or_si256(in0, in1)) == 0)
+		{
+			error= prevIncomplete;
+			prevIncomplete= _mm256_setzero_si256();
+		}
+
+		else
+		{
+			error= unicoder_avx2_utf8Check(in0, prevInput);
+			error= _mm256_or_si256(error, unicoder_avx2_utf8Check(in1, in0));
+			prevIncomplete= _mm256_subs_epu8(in1, incompleteMax);
+		}
+
+		if(!_mm256_testz_si256(error, error))
+			return i;
+
+		prevInput= in1;
+	}
+
+	if(!_mm256_testz_si256(prevIncomplete, prevIncomplete))
+		return i - 64;
+
+	return len;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX512)
+
+UNICODER_INLINE UNICODER_TARGET_AVX512 __m512i unicoder_avx512_utf8Check(__m512i input, __m512i prevInput)
+{
+	__m512i carried, prev1, prev2, prev3, byte1High, byte1Low, byte2High, special, must23;
+	const __m512i nibble= _mm512_set1_epi8(0x0f);
+
+	/* alignr still works within 128 bit lanes, valignq lines every lane up with the one before it */
+	carried= _mm512_alignr_epi64(input, prevInput, 6);
+	prev1= _mm512_alignr_epi8(input, carried, 15);
+	prev2= _mm512_alignr_epi8(input, carried, 14);
+	prev3= _mm512_alignr_epi8(input, carried, 13);
+
+	byte1High= _mm512_shuffle_epi8(_mm512_broadcast_i32x4(_mm_setr_epi8(UNICODER_U8_BYTE_1_HIGH)),
+	                               _mm512_and_si512(_mm512_srli_epi16(prev1, 4), nibble));
+	byte1Low=  _mm512_shuffle_epi8(_mm512_broadcast_i32x4(_mm_setr_epi8(UNICODER_U8_BYTE_1_LOW)),
+	                               _mm512_and_si512(prev1, nibble));
+	byte2High= _mm512_shuffle_epi8(_mm512_broadcast_i32x4(_mm_setr_epi8(UNICODER_U8_BYTE_2_HIGH)),
+	                               _mm512_and_si512(_mm512_srli_epi16(input, 4), nibble));
+
+	/* 0x80 is the truth table of a & b & c */
+	special= _mm512_ternarylogic_epi32(byte1High, byte1Low, byte2High, 0x80);
+
+	must23= _mm512_or_si512(_mm512_subs_epu8(prev2, _mm512_set1_epi8((char) (0xe0 - 0x80))),
+	                        _mm512_subs_epu8(prev3, _mm512_set1_epi8((char) (0xf0 - 0x80))));
+
+	return _mm512_xor_si512(_mm512_and_si512(must23, _mm512_set1_epi8((char) 0x80)), special);
+}
+
+
+/* returns start of the first 64 byte block that holds an error, or len if there is none */
+static UNICODER_TARGET_AVX512 size_t unicoder_avx512_utf8FindErrorBlock(const unsigned char* buf, size_t len)
+{
+	size_t i;
+	__m512i in, error, prevInput, prevIncomplete;
+	const __m512i incompleteMax= _mm512_inserti32x4(_mm512_set1_epi8(-1), _mm_setr_epi8(UNICODER_U8_INCOMPLETE_MAX), 3);
+
+	prevInput= _mm512_setzero_si512();
+	prevIncomplete= _mm512_setzero_si512();
+
+	for(i= 0; i < len; i += 64)
+	{
+		/* the last block is zero filled by a masked load rather than copied */
+		if(len - i < 64)
+			in= _mm512_maskz_loadu_epi8((__mmask64) ((1ull << (len - i)) - 1), buf + i);
+		else
+			in= _mm512_loadu_si512((const void*) (buf + i));
+
+		if(_mm512_movepi8_mask(in) == 0)
+		{
+			error= prevIncomplete;
+			prevIncomplete= _mm512_setzero_si512();
+		}
+
+		else
+		{
+			error= unicoder_avx512_utf8Check(in, prevInput);
+			prevIncomplete= _mm512_subs_epu8(in, incompleteMax);
+		}
+
+		if(_mm512_test_epi8_mask(error, error) != 0)
+			return i;
+
+		prevInput= in;
+	}
+
+	if(_mm512_test_epi8_mask(prevIncomplete, prevIncomplete) != 0)
+		return i - 64;
+
+	return len;
+}
+
+#endif
+
+
+/* no vector unit, so every block is suspect and the scalar loop does all the work */
+static size_t unicoder_scalar_utf8FindErrorBlock(const unsigned char* buf, size_t len)
+{
+	(void) buf;
+	return (len > 0) ? 0 : len;
+}
+
+
+/* start of the first 64 byte block that may hold an error, or len if there is none */
+UNICODER_INLINE size_t unicoder_utf8_findErrorBlock(const unsigned char* buf, size_t len)
+{
+	return unicoder_kernels()->utf8FindErrorBlock(buf, len);
+}
+
+
+/* checks that len bytes at buf are well formed utf-8 (no overlongs, surrogates or values past 0x10ffff) */
+/* returns 0 if so, otherwise error code with the offset of the first bad sequence stored in errorOffset (may be NULL) */
+int unicoder_utf8_validate(const unsigned char* buf, size_t len, size_t* errorOffset)
+{
+	size_t blockStart, restart, offset;
+	int ret;
+	UNICODER_TIMER_DECLARE(started)
+
+	if(errorOffset != NULL)
+		*errorOffset= 0;
+
+	if(buf == NULL  &&  len > 0)
+		return UNICODER_NULL_POINTER;
+
+	UNICODER_TIMER_START(started);
+	blockStart= unicoder_utf8_findErrorBlock(buf, len);
+	if(blockStart == len)
+	{
+		UNICODER_TIMER_STOP(started, UNICODER_TIMER_VALIDATE);
+		if(errorOffset != NULL)
+			*errorOffset= len;
+		return 0;
+	}
+
+	restart= unicoder_utf8_rewind(buf, blockStart);
+	ret= unicoder_utf8_validateScalar(buf + restart, len - restart, &offset);
+	UNICODER_TIMER_STOP(started, UNICODER_TIMER_VALIDATE);
+
+	if(errorOffset != NULL)
+		*errorOffset= restart + offset;
+
+	return ret;
+}
+
+
+static int unicoder_transcode_utf8_utf8(const unsigned char* src, size_t srcLen,
+                                        unsigned char* dst, size_t dstCap,
+                                        size_t* consumed, size_t* produced)
+{
+	size_t limit, valid;
+	int ret, bytesRead;
+	unsigned int x;
+
+	limit= (srcLen < dstCap) ? srcLen : dstCap;
+	ret= unicoder_utf8_validate(src, limit, &valid);
+
+	/* stopping at dstCap looks like a truncated sequence, decide with the full source */
+	if(valid < srcLen  &&  limit < srcLen  &&  (ret == 0  ||  ret == UNICODER_INCOMPLETE_SEQUENCE))
+	{
+		bytesRead= unicoder_utf8_read(src + valid, srcLen - valid, &x);
+		ret= (bytesRead < 0) ? bytesRead : UNICODER_OUTPUT_BUFFER_FULL;
+	}
+
+	memcpy(dst, src, valid);
+	*consumed= valid;
+	*produced= valid;
+	return ret;
+}
+
+
+
+/*
+utf-8 to utf-16.
+
+Input is handled in chunks of a few KB: the chunk is validated with the vector checker while it
+sits in L1, then the kernel below converts it without checking anything, and the scalar steps
+finish whatever the kernel leaves (the last few bytes, or everything from the first error on).
+
+The kernel looks at a whole window at once. For every byte it works out the utf-16 unit that a
+sequence ending at that byte would produce, from the byte itself and the one or two before it.
+The bytes that really end a sequence are kept and packed together with a shuffle from
+unicoder_compressIndex, or with vpcompressw on avx-512. A 4 byte sequence keeps two slots: the low surrogate goes where its last
+byte was and the high surrogate where its third byte was, so pairs come out in order for free.
+*/
+
+#if defined(UNICODER_SIMD)
+
+#define  UNICODER_CHUNK  4096
+
+/* entry m lists, in order, the positions of the bits set in m, padded with zeros */
+static const unsigned char unicoder_compressIndex[256][8]=
+{
+	{ 0, 0, 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0, 0, 0 }, { 0, 1, 0, 0, 0, 0, 0, 0 },
+	{ 2, 0, 0, 0, 0, 0, 0, 0 }, { 0, 2, 0, 0, 0, 0, 0, 0 }, { 1, 2, 0, 0, 0, 0, 0, 0 }, { 0, 1, 2, 0, 0, 0, 0, 0 },
+	{ 3, 0, 0, 0, 0, 0, 0, 0 }, { 0, 3, 0, 0, 0, 0, 0, 0 }, { 1, 3, 0, 0, 0, 0, 0, 0 }, { 0, 1, 3, 0, 0, 0, 0, 0 },
+	{ 2, 3, 0, 0, 0, 0, 0, 0 }, { 0, 2, 3, 0, 0, 0, 0, 0 }, { 1, 2, 3, 0, 0, 0, 0, 0 }, { 0, 1, 2, 3, 0, 0, 0, 0 },
+	{ 4, 0, 0, 0, 0, 0, 0, 0 }, { 0, 4, 0, 0, 0, 0, 0, 0 }, { 1, 4, 0, 0, 0, 0, 0, 0 }, { 0, 1, 4, 0, 0, 0, 0, 0 },
+	{ 2, 4, 0, 0, 0, 0, 0, 0 }, { 0, 2, 4, 0, 0, 0, 0, 0 }, { 1, 2, 4, 0, 0, 0, 0, 0 }, { 0, 1, 2, 4, 0, 0, 0, 0 },
+	{ 3, 4, 0, 0, 0, 0, 0, 0 }, { 0, 3, 4, 0, 0, 0, 0, 0 }, { 1, 3, 4, 0, 0, 0, 0, 0 }, { 0, 1, 3, 4, 0, 0, 0, 0 },
+	{ 2, 3, 4, 0, 0, 0, 0, 0 }, { 0, 2, 3, 4, 0, 0, 0, 0 }, { 1, 2, 3, 4, 0, 0, 0, 0 }, { 0, 1, 2, 3, 4, 0, 0, 0 },
+	{ 5, 0, 0, 0, 0, 0, 0, 0 }, { 0, 5, 0, 0, 0, 0, 0, 0 }, { 1, 5, 0, 0, 0, 0, 0, 0 }, { 0, 1, 5, 0, 0, 0, 0, 0 },
+	{ 2, 5, 0, 0, 0, 0, 0, 0 }, { 0, 2, 5, 0, 0, 0, 0, 0 }, { 1, 2, 5, 0, 0, 0, 0, 0 }, { 0, 1, 2, 5, 0, 0, 0, 0 },
+	{ 3, 5, 0, 0, 0, 0, 0, 0 }, { 0, 3, 5, 0, 0, 0, 0, 0 }, { 1, 3, 5, 0, 0, 0, 0, 0 }, { 0, 1, 3, 5, 0, 0, 0, 0 },
+	{ 2, 3, 5, 0, 0, 0, 0, 0 }, { 0, 2, 3, 5, 0, 0, 0, 0 }, { 1, 2, 3, 5, 0, 0, 0, 0 }, { 0, 1, 2, 3, 5, 0, 0, 0 },
+	{ 4, 5, 0, 0, 0, 0, 0, 0 }, { 0, 4, 5, 0, 0, 0, 0, 0 }, { 1, 4, 5, 0, 0, 0, 0, 0 }, { 0, 1, 4, 5, 0, 0, 0, 0 },
+	{ 2, 4, 5, 0, 0, 0, 0, 0 }, { 0, 2, 4, 5, 0, 0, 0, 0 }, { 1, 2, 4, 5, 0, 0, 0, 0 }, { 0, 1, 2, 4, 5, 0, 0, 0 },
+	{ 3, 4, 5, 0, 0, 0, 0, 0 }, { 0, 3, 4, 5, 0, 0, 0, 0 }, { 1, 3, 4, 5, 0, 0, 0, 0 }, { 0, 1, 3, 4, 5, 0, 0, 0 },
+	{ 2, 3, 4, 5, 0, 0, 0, 0 }, { 0, 2, 3, 4, 5, 0, 0, 0 }, { 1, 2, 3, 4, 5, 0, 0, 0 }, { 0, 1, 2, 3, 4, 5, 0, 0 },
+	{ 6, 0, 0, 0, 0, 0, 0, 0 }, { 0, 6, 0, 0, 0, 0, 0, 0 }, { 1, 6, 0, 0, 0, 0, 0, 0 }, { 0, 1, 6, 0, 0, 0, 0, 0 },
+	{ 2, 6, 0, 0, 0, 0, 0, 0 }, { 0, 2, 6, 0, 0, 0, 0, 0 }, { 1, 2, 6, 0, 0, 0, 0, 0 }, { 0, 1, 2, 6, 0, 0, 0, 0 },
+	{ 3, 6, 0, 0, 0, 0, 0, 0 }, { 0, 3, 6, 0, 0, 0, 0, 0 }, { 1, 3, 6, 0, 0, 0, 0, 0 }, { 0, 1, 3, 6, 0, 0, 0, 0 },
+	{ 2, 3, 6, 0, 0, 0, 0, 0 }, { 0, 2, 3, 6, 0, 0, 0, 0 }, { 1, 2, 3, 6, 0, 0, 0, 0 }, { 0, 1, 2, 3, 6, 0, 0, 0 },
+	{ 4, 6, 0, 0, 0, 0, 0, 0 }, { 0, 4, 6, 0, 0, 0, 0, 0 }, { 1, 4, 6, 0, 0, 0, 0, 0 }, { 0, 1, 4, 6, 0, 0, 0, 0 },
+	{ 2, 4, 6, 0, 0, 0, 0, 0 }, { 0, 2, 4, 6, 0, 0, 0, 0 }, { 1, 2, 4, 6, 0, 0, 0, 0 }, { 0, 1, 2, 4, 6, 0, 0, 0 },
+	{ 3, 4, 6, 0, 0, 0, 0, 0 }, { 0, 3, 4, 6, 0, 0, 0, 0 }, { 1, 3, 4, 6, 0, 0, 0, 0 }, { 0, 1, 3, 4, 6, 0, 0, 0 },
+	{ 2, 3, 4, 6, 0, 0, 0, 0 }, { 0, 2, 3, 4, 6, 0, 0, 0 }, { 1, 2, 3, 4, 6, 0, 0, 0 }, { 0, 1, 2, 3, 4, 6, 0, 0 },
+	{ 5, 6, 0, 0, 0, 0, 0, 0 }, { 0, 5, 6, 0, 0, 0, 0, 0 }, { 1, 5, 6, 0, 0, 0, 0, 0 }, { 0, 1, 5, 6, 0, 0, 0, 0 },
+	{ 2, 5, 6, 0, 0, 0, 0, 0 }, { 0, 2, 5, 6, 0, 0, 0, 0 }, { 1, 2, 5, 6, 0, 0, 0, 0 }, { 0, 1, 2, 5, 6, 0, 0, 0 },
+	{ 3, 5, 6, 0, 0, 0, 0, 0 }, { 0, 3, 5, 6, 0, 0, 0, 0 }, { 1, 3, 5, 6, 0, 0, 0, 0 }, { 0, 1, 3, 5, 6, 0, 0, 0 },
+	{ 2, 3, 5, 6, 0, 0, 0, 0 }, { 0, 2, 3, 5, 6, 0, 0, 0 }, { 1, 2, 3, 5, 6, 0, 0, 0 }, { 0, 1, 2, 3, 5, 6, 0, 0 },
+	{ 4, 5, 6, 0, 0, 0, 0, 0 }, { 0, 4, 5, 6, 0, 0, 0, 0 }, { 1, 4, 5, 6, 0, 0, 0, 0 }, { 0, 1, 4, 5, 6, 0, 0, 0 },
+	{ 2, 4, 5, 6, 0, 0, 0, 0 }, { 0, 2, 4, 5, 6, 0, 0, 0 }, { 1, 2, 4, 5, 6, 0, 0, 0 }, { 0, 1, 2, 4, 5, 6, 0, 0 },
+	{ 3, 4, 5, 6, 0, 0, 0, 0 }, { 0, 3, 4, 5, 6, 0, 0, 0 }, { 1, 3, 4, 5, 6, 0, 0, 0 }, { 0, 1, 3, 4, 5, 6, 0, 0 },
+	{ 2, 3, 4, 5, 6, 0, 0, 0 }, { 0, 2, 3, 4, 5, 6, 0, 0 }, { 1, 2, 3, 4, 5, 6, 0, 0 }, { 0, 1, 2, 3, 4, 5, 6, 0 },
+	{ 7, 0, 0, 0, 0, 0, 0, 0 }, { 0, 7, 0, 0, 0, 0, 0, 0 }, { 1, 7, 0, 0, 0, 0, 0, 0 }, { 0, 1, 7, 0, 0, 0, 0, 0 },
+	{ 2, 7, 0, 0, 0, 0, 0, 0 }, { 0, 2, 7, 0, 0, 0, 0, 0 }, { 1, 2, 7, 0, 0, 0, 0, 0 }, { 0, 1, 2, 7, 0, 0, 0, 0 },
+	{ 3, 7, 0, 0, 0, 0, 0, 0 }, { 0, 3, 7, 0, 0, 0, 0, 0 }, { 1, 3, 7, 0, 0, 0, 0, 0 }, { 0, 1, 3, 7, 0, 0, 0, 0 },
+	{ 2, 3, 7, 0, 0, 0, 0, 0 }, { 0, 2, 3, 7, 0, 0, 0, 0 }, { 1, 2, 3, 7, 0, 0, 0, 0 }, { 0, 1, 2, 3, 7, 0, 0, 0 },
+	{ 4, 7, 0, 0, 0, 0, 0, 0 }, { 0, 4, 7, 0, 0, 0, 0, 0 }, { 1, 4, 7, 0, 0, 0, 0, 0 }, { 0, 1, 4, 7, 0, 0, 0, 0 },
+	{ 2, 4, 7, 0, 0, 0, 0, 0 }, { 0, 2, 4, 7, 0, 0, 0, 0 }, { 1, 2, 4, 7, 0, 0, 0, 0 }, { 0, 1, 2, 4, 7, 0, 0, 0 },
+	{ 3, 4, 7, 0, 0, 0, 0, 0 }, { 0, 3, 4, 7, 0, 0, 0, 0 }, { 1, 3, 4, 7, 0, 0, 0, 0 }, { 0, 1, 3, 4, 7, 0, 0, 0 },
+	{ 2, 3, 4, 7, 0, 0, 0, 0 }, { 0, 2, 3, 4, 7, 0, 0, 0 }, { 1, 2, 3, 4, 7, 0, 0, 0 }, { 0, 1, 2, 3, 4, 7, 0, 0 },
+	{ 5, 7, 0, 0, 0, 0, 0, 0 }, { 0, 5, 7, 0, 0, 0, 0, 0 }, { 1, 5, 7, 0, 0, 0, 0, 0 }, { 0, 1, 5, 7, 0, 0, 0, 0 },
+	{ 2, 5, 7, 0, 0, 0, 0, 0 }, { 0, 2, 5, 7, 0, 0, 0, 0 }, { 1, 2, 5, 7, 0, 0, 0, 0 }, { 0, 1, 2, 5, 7, 0, 0, 0 },
+	{ 3, 5, 7, 0, 0, 0, 0, 0 }, { 0, 3, 5, 7, 0, 0, 0, 0 }, { 1, 3, 5, 7, 0, 0, 0, 0 }, { 0, 1, 3, 5, 7, 0, 0, 0 },
+	{ 2, 3, 5, 7, 0, 0, 0, 0 }, { 0, 2, 3, 5, 7, 0, 0, 0 }, { 1, 2, 3, 5, 7, 0, 0, 0 }, { 0, 1, 2, 3, 5, 7, 0, 0 },
+	{ 4, 5, 7, 0, 0, 0, 0, 0 }, { 0, 4, 5, 7, 0, 0, 0, 0 }, { 1, 4, 5, 7, 0, 0, 0, 0 }, { 0, 1, 4, 5, 7, 0, 0, 0 },
+	{ 2, 4, 5, 7, 0, 0, 0, 0 }, { 0, 2, 4, 5, 7, 0, 0, 0 }, { 1, 2, 4, 5, 7, 0, 0, 0 }, { 0, 1, 2, 4, 5, 7, 0, 0 },
+	{ 3, 4, 5, 7, 0, 0, 0, 0 }, { 0, 3, 4, 5, 7, 0, 0, 0 }, { 1, 3, 4, 5, 7, 0, 0, 0 }, { 0, 1, 3, 4, 5, 7, 0, 0 },
+	{ 2, 3, 4, 5, 7, 0, 0, 0 }, { 0, 2, 3, 4, 5, 7, 0, 0 }, { 1, 2, 3, 4, 5, 7, 0, 0 }, { 0, 1, 2, 3, 4, 5, 7, 0 },
+	{ 6, 7, 0, 0, 0, 0, 0, 0 }, { 0, 6, 7, 0, 0, 0, 0, 0 }, { 1, 6, 7, 0, 0, 0, 0, 0 }, { 0, 1, 6, 7, 0, 0, 0, 0 },
+	{ 2, 6, 7, 0, 0, 0, 0, 0 }, { 0, 2, 6, 7, 0, 0, 0, 0 }, { 1, 2, 6, 7, 0, 0, 0, 0 }, { 0, 1, 2, 6, 7, 0, 0, 0 },
+	{ 3, 6, 7, 0, 0, 0, 0, 0 }, { 0, 3, 6, 7, 0, 0, 0, 0 }, { 1, 3, 6, 7, 0, 0, 0, 0 }, { 0, 1, 3, 6, 7, 0, 0, 0 },
+	{ 2, 3, 6, 7, 0, 0, 0, 0 }, { 0, 2, 3, 6, 7, 0, 0, 0 }, { 1, 2, 3, 6, 7, 0, 0, 0 }, { 0, 1, 2, 3, 6, 7, 0, 0 },
+	{ 4, 6, 7, 0, 0, 0, 0, 0 }, { 0, 4, 6, 7, 0, 0, 0, 0 }, { 1, 4, 6, 7, 0, 0, 0, 0 }, { 0, 1, 4, 6, 7, 0, 0, 0 },
+	{ 2, 4, 6, 7, 0, 0, 0, 0 }, { 0, 2, 4, 6, 7, 0, 0, 0 }, { 1, 2, 4, 6, 7, 0, 0, 0 }, { 0, 1, 2, 4, 6, 7, 0, 0 },
+	{ 3, 4, 6, 7, 0, 0, 0, 0 }, { 0, 3, 4, 6, 7, 0, 0, 0 }, { 1, 3, 4, 6, 7, 0, 0, 0 }, { 0, 1, 3, 4, 6, 7, 0, 0 },
+	{ 2, 3, 4, 6, 7, 0, 0, 0 }, { 0, 2, 3, 4, 6, 7, 0, 0 }, { 1, 2, 3, 4, 6, 7, 0, 0 }, { 0, 1, 2, 3, 4, 6, 7, 0 },
+	{ 5, 6, 7, 0, 0, 0, 0, 0 }, { 0, 5, 6, 7, 0, 0, 0, 0 }, { 1, 5, 6, 7, 0, 0, 0, 0 }, { 0, 1, 5, 6, 7, 0, 0, 0 },
+	{ 2, 5, 6, 7, 0, 0, 0, 0 }, { 0, 2, 5, 6, 7, 0, 0, 0 }, { 1, 2, 5, 6, 7, 0, 0, 0 }, { 0, 1, 2, 5, 6, 7, 0, 0 },
+	{ 3, 5, 6, 7, 0, 0, 0, 0 }, { 0, 3, 5, 6, 7, 0, 0, 0 }, { 1, 3, 5, 6, 7, 0, 0, 0 }, { 0, 1, 3, 5, 6, 7, 0, 0 },
+	{ 2, 3, 5, 6, 7, 0, 0, 0 }, { 0, 2, 3, 5, 6, 7, 0, 0 }, { 1, 2, 3, 5, 6, 7, 0, 0 }, { 0, 1, 2, 3, 5, 6, 7, 0 },
+	{ 4, 5, 6, 7, 0, 0, 0, 0 }, { 0, 4, 5, 6, 7, 0, 0, 0 }, { 1, 4, 5, 6, 7, 0, 0, 0 }, { 0, 1, 4, 5, 6, 7, 0, 0 },
+	{ 2, 4, 5, 6, 7, 0, 0, 0 }, { 0, 2, 4, 5, 6, 7, 0, 0 }, { 1, 2, 4, 5, 6, 7, 0, 0 }, { 0, 1, 2, 4, 5, 6, 7, 0 },
+	{ 3, 4, 5, 6, 7, 0, 0, 0 }, { 0, 3, 4, 5, 6, 7, 0, 0 }, { 1, 3, 4, 5, 6, 7, 0, 0 }, { 0, 1, 3, 4, 5, 6, 7, 0 },
+	{ 2, 3, 4, 5, 6, 7, 0, 0 }, { 0, 2, 3, 4, 5, 6, 7, 0 }, { 1, 2, 3, 4, 5, 6, 7, 0 }, { 0, 1, 2, 3, 4, 5, 6, 7 }
+};
+
+/* number of bits set in each byte value */
+static const unsigned char unicoder_bitCount[256]=
+{
+	0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+	1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+	1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+	2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+	1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+	2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+	2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+	3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+	1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+	2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+	2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+	3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+	2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+	3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+	3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+	4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8
+};
+
+
+/* index of the highest set bit, x must not be 0 */
+UNICODER_INLINE unsigned int unicoder_highestBit(unsigned int x)
+{
+#if defined(__GNUC__)
+	return 31 - __builtin_clz(x);
+#else
+	unsigned int i= 0;
+
+	while(x >>= 1)
+		i++;
+
+	return i;
+#endif
+}
+
+
+/* index of the highest set bit of a 64 bit mask, x must not be 0 */
+UNICODER_INLINE unsigned int unicoder_highestBit64(unsigned long long x)
+{
+#if defined(__GNUC__)
+	return 63 - __builtin_clzll(x);
+#else
+	unsigned int i= 0;
+
+	while(x >>= 1)
+		i++;
+
+	return i;
+#endif
+}
+
+
+/* index of the lowest set bit of a 64 bit mask, x must not be 0 */
+UNICODER_INLINE unsigned int unicoder_lowestBit64(unsigned long long x)
+{
+#if defined(__GNUC__)
+	return (unsigned int) __builtin_ctzll(x);
+#else
+	unsigned int i= 0;
+
+	for(; (x & 1) == 0; x >>= 1)
+		i++;
+
+	return i;
+#endif
+}
+
+
+/* number of bits set in a 64 bit mask */
+UNICODER_INLINE unsigned int unicoder_bitCount64(unsigned long long x)
+{
+#if defined(__GNUC__)
+	return (unsigned int) __builtin_popcountll(x);
+#else
+	unsigned int n= 0;
+
+	for(; x != 0; x >>= 8)
+		n += unicoder_bitCount[x & 0xff];
+
+	return n;
+#endif
+}
+
+
+/* packs the 16 bit lanes of units selected by mask to the front of p, returns bytes stored */
+UNICODER_INLINE UNICODER_TARGET_SSE size_t unicoder_sse_compressStore16(unsigned char* p, __m128i units, unsigned int mask)
+{
+	__m128i index;
+
+	index= _mm_loadl_epi64((const __m128i*) unicoder_compressIndex[mask]);
+	index= _mm_add_epi8(index, index);
+	index= _mm_unpacklo_epi8(index, _mm_add_epi8(index, _mm_set1_epi8(1)));
+
+	_mm_storeu_si128((__m128i*) p, _mm_shuffle_epi8(units, index));
+	return 2 * (size_t) unicoder_bitCount[mask];
+}
+
+
+UNICODER_INLINE UNICODER_TARGET_SSE __m128i unicoder_sse_swap16(__m128i units)
+{
+	return _mm_or_si128(_mm_slli_epi16(units, 8), _mm_srli_epi16(units, 8));
+}
+
+
+#if defined(UNICODER_SSE)
+
+/* converts up to 16 bytes of valid utf-8 at p into at most 32 bytes at q */
+/* returns bytes consumed, which always end on a code point boundary, and stores bytes written in written */
+UNICODER_INLINE UNICODER_TARGET_SSE size_t unicoder_sse_utf8ToUtf16(const unsigned char* p, unsigned char* q, size_t* written, unsigned int endianness)
+{
+	__m128i in, prev1, prev2, cont0, cont1, lead4, high4, end4, lo, hi, units0, units1;
+	const __m128i zero= _mm_setzero_si128();
+	unsigned int keep, lastEnd;
+	size_t n;
+
+	in= _mm_loadu_si128((const __m128i*) p);
+
+	if(_mm_movemask_epi8(in) == 0)
+	{
+		if(endianness == UNICODER_LES)
+		{
+			_mm_storeu_si128((__m128i*) q, _mm_unpacklo_epi8(in, zero));
+			_mm_storeu_si128((__m128i*) (q + 16), _mm_unpackhi_epi8(in, zero));
+		}
+
+		else
+		{
+			_mm_storeu_si128((__m128i*) q, _mm_unpacklo_epi8(zero, in));
+			_mm_storeu_si128((__m128i*) (q + 16), _mm_unpackhi_epi8(zero, in));
+		}
+
+		*written= 32;
+		return 16;
+	}
+
+	/* byte i ends a code point when byte i + 1 is not a continuation, the last byte can't tell */
+	cont0= _mm_cmplt_epi8(in, _mm_set1_epi8(-64));
+	keep= ~((unsigned int) _mm_movemask_epi8(cont0) >> 1) & 0x7fff;
+	lastEnd= unicoder_highestBit(keep);
+
+	prev1= _mm_slli_si128(in, 1);
+	prev2= _mm_slli_si128(in, 2);
+	cont1= _mm_slli_si128(cont0, 1);
+
+	/* low byte: 7 bits of an ascii byte or 6 of a continuation, plus 2 from the byte before */
+	lo= _mm_and_si128(_mm_slli_epi16(prev1, 6), _mm_and_si128(cont0, _mm_set1_epi8((char) 0xc0)));
+	lo= _mm_or_si128(lo, _mm_and_si128(in, _mm_set1_epi8(0x7f)));
+
+	/* high byte: the other 4 bits of the byte before, plus the lead of a 3 byte sequence */
+	hi= _mm_and_si128(_mm_srli_epi16(prev1, 2), _mm_set1_epi8(0x0f));
+	hi= _mm_or_si128(hi, _mm_and_si128(_mm_slli_epi16(prev2, 4), _mm_and_si128(cont1, _mm_set1_epi8((char) 0xf0))));
+	hi= _mm_and_si128(hi, cont0);
+
+	units0= _mm_unpacklo_epi8(lo, hi);
+	units1= _mm_unpackhi_epi8(lo, hi);
+
+	lead4= _mm_cmpeq_epi8(_mm_max_epu8(in, _mm_set1_epi8((char) 0xf0)), in);
+	if(_mm_movemask_epi8(lead4) != 0)
+	{
+		__m128i highLo, highHi, highBias;
+
+		high4= _mm_slli_si128(lead4, 2);
+		end4= _mm_slli_si128(lead4, 3);
+		keep |= (unsigned int) _mm_movemask_epi8(high4);
+
+		/* the low surrogate keeps its 10 bits and takes DC in the top 6 */
+		hi= _mm_blendv_epi8(hi, _mm_or_si128(_mm_and_si128(hi, _mm_set1_epi8(0x03)), _mm_set1_epi8((char) 0xdc)), end4);
+
+		/* the high surrogate is D7C0 plus bits 20..10 of the code point, from bytes 1, 2 and 3 */
+		highLo= _mm_or_si128(_mm_and_si128(_mm_slli_epi16(prev1, 2), _mm_set1_epi8((char) 0xfc)),
+		                     _mm_and_si128(_mm_srli_epi16(in, 4), _mm_set1_epi8(0x03)));
+		highHi= _mm_and_si128(prev2, _mm_set1_epi8(0x07));
+		lo= _mm_blendv_epi8(lo, highLo, high4);
+		hi= _mm_blendv_epi8(hi, highHi, high4);
+
+		highBias= _mm_unpacklo_epi8(_mm_and_si128(high4, _mm_set1_epi8((char) 0xc0)),
+		                            _mm_and_si128(high4, _mm_set1_epi8((char) 0xd7)));
+		units0= _mm_add_epi16(_mm_unpacklo_epi8(lo, hi), highBias);
+
+		highBias= _mm_unpackhi_epi8(_mm_and_si128(high4, _mm_set1_epi8((char) 0xc0)),
+		                            _mm_and_si128(high4, _mm_set1_epi8((char) 0xd7)));
+		units1= _mm_add_epi16(_mm_unpackhi_epi8(lo, hi), highBias);
+	}
+
+	/* a surrogate slot past the last complete sequence belongs to the next window */
+	keep &= (2u << lastEnd) - 1;
+
+	if(endianness == UNICODER_BES)
+	{
+		units0= unicoder_sse_swap16(units0);
+		units1= unicoder_sse_swap16(units1);
+	}
+
+	n= unicoder_sse_compressStore16(q, units0, keep & 0xff);
+	n += unicoder_sse_compressStore16(q + n, units1, keep >> 8);
+
+	*written= n;
+	return lastEnd + 1;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX2)
+
+/* shifts the 32 bytes of x up by n (1..15) bytes across the lane boundary, filling with zeros */
+#define  UNICODER_AVX2_SHIFT_IN(x, n)  _mm256_alignr_epi8((x), _mm256_permute2x128_si256((x), (x), 0x08), 16 - (n))
+
+/* converts up to 32 bytes of valid utf-8 at p into at most 64 bytes at q */
+/* returns bytes consumed, which always end on a code point boundary, and stores bytes written in written */
+UNICODER_INLINE UNICODER_TARGET_AVX2 size_t unicoder_avx2_utf8ToUtf16(const unsigned char* p, unsigned char* q, size_t* written, unsigned int endianness)
+{
+	__m256i in, prev1, prev2, cont0, cont1, lead4, high4, end4, lo, hi, unitsA, unitsB;
+	unsigned int keep, lastEnd;
+	size_t n;
+
+	in= _mm256_loadu_si256((const __m256i*) p);
+
+	if(_mm256_movemask_epi8(in) == 0)
+	{
+		unitsA= _mm256_cvtepu8_epi16(_mm256_castsi256_si128(in));
+		unitsB= _mm256_cvtepu8_epi16(_mm256_extracti128_si256(in, 1));
+
+		if(endianness == UNICODER_BES)
+		{
+			unitsA= _mm256_slli_epi16(unitsA, 8);
+			unitsB= _mm256_slli_epi16(unitsB, 8);
+		}
+
+		_mm256_storeu_si256((__m256i*) q, unitsA);
+		_mm256_storeu_si256((__m256i*) (q + 32), unitsB);
+		*written= 64;
+		return 32;
+	}
+
+	/* byte i ends a code point when byte i + 1 is not a continuation, the last byte can't tell */
+	cont0= _mm256_cmpgt_epi8(_mm256_set1_epi8(-64), in);
+	keep= ~((unsigned int) _mm256_movemask_epi8(cont0) >> 1) & 0x7fffffff;
+	lastEnd= unicoder_highestBit(keep);
+
+	prev1= UNICODER_AVX2_SHIFT_IN(in, 1);
+	prev2= UNICODER_AVX2_SHIFT_IN(in, 2);
+	cont1= UNICODER_AVX2_SHIFT_IN(cont0, 1);
+
+	/* low byte: 7 bits of an ascii byte or 6 of a continuation, plus 2 from the byte before */
+	lo= _mm256_and_si256(_mm256_slli_epi16(prev1, 6), _mm256_and_si256(cont0, _mm256_set1_epi8((char) 0xc0)));
+	lo= _mm256_or_si256(lo, _mm256_and_si256(in, _mm256_set1_epi8(0x7f)));
+
+	/* high byte: the other 4 bits of the byte before, plus the lead of a 3 byte sequence */
+	hi= _mm256_and_si256(_mm256_srli_epi16(prev1, 2), _mm256_set1_epi8(0x0f));
+	hi= _mm256_or_si256(hi, _mm256_and_si256(_mm256_slli_epi16(prev2, 4), _mm256_and_si256(cont1, _mm256_set1_epi8((char) 0xf0))));
+	hi= _mm256_and_si256(hi, cont0);
+
+	/* unpacking stays within lanes: A holds positions 0..7 and 16..23, B holds 8..15 and 24..31 */
+	unitsA= _mm256_unpacklo_epi8(lo, hi);
+	unitsB= _mm256_unpackhi_epi8(lo, hi);
+
+	lead4= _mm256_cmpeq_epi8(_mm256_max_epu8(in, _mm256_set1_epi8((char) 0xf0)), in);
+	if(_mm256_movemask_epi8(lead4) != 0)
+	{
+		__m256i highLo, highHi, biasLo, biasHi;
+
+		high4= UNICODER_AVX2_SHIFT_IN(lead4, 2);
+		end4= UNICODER_AVX2_SHIFT_IN(lead4, 3);
+		keep |= (unsigned int) _mm256_movemask_epi8(high4);
+
+		/* the low surrogate keeps its 10 bits and takes DC in the top 6 */
+		hi= _mm256_blendv_epi8(hi, _mm256_or_si256(_mm256_and_si256(hi, _mm256_set1_epi8(0x03)), _mm256_set1_epi8((char) 0xdc)), end4);
+
+		/* the high surrogate is D7C0 plus bits 20..10 of the code point, from bytes 1, 2 and 3 */
+		highLo= _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi16(prev1, 2), _mm256_set1_epi8((char) 0xfc)),
+		                        _mm256_and_si256(_mm256_srli_epi16(in, 4), _mm256_set1_epi8(0x03)));
+		highHi= _mm256_and_si256(prev2, _mm256_set1_epi8(0x07));
+		lo= _mm256_blendv_epi8(lo, highLo, high4);
+		hi= _mm256_blendv_epi8(hi, highHi, high4);
+
+		biasLo= _mm256_and_si256(high4, _mm256_set1_epi8((char) 0xc0));
+		biasHi= _mm256_and_si256(high4, _mm256_set1_epi8((char) 0xd7));
+		unitsA= _mm256_add_epi16(_mm256_unpacklo_epi8(lo, hi), _mm256_unpacklo_epi8(biasLo, biasHi));
+		unitsB= _mm256_add_epi16(_mm256_unpackhi_epi8(lo, hi), _mm256_unpackhi_epi8(biasLo, biasHi));
+	}
+
+	/* a surrogate slot past the last complete sequence belongs to the next window */
+	keep &= (2u << lastEnd) - 1;
+
+	if(endianness == UNICODER_BES)
+	{
+		unitsA= _mm256_or_si256(_mm256_slli_epi16(unitsA, 8), _mm256_srli_epi16(unitsA, 8));
+		unitsB= _mm256_or_si256(_mm256_slli_epi16(unitsB, 8), _mm256_srli_epi16(unitsB, 8));
+	}
+
+	n= unicoder_sse_compressStore16(q, _mm256_castsi256_si128(unitsA), keep & 0xff);
+	n += unicoder_sse_compressStore16(q + n, _mm256_castsi256_si128(unitsB), (keep >> 8) & 0xff);
+	n += unicoder_sse_compressStore16(q + n, _mm256_extracti128_si256(unitsA, 1), (keep >> 16) & 0xff);
+	n += unicoder_sse_compressStore16(q + n, _mm256_extracti128_si256(unitsB, 1), keep >> 24);
+
+	*written= n;
+	return lastEnd + 1;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX512)
+
+/* converts up to 64 bytes of valid utf-8 at p into at most 128 bytes at q, same scheme as the */
+/* avx2 kernel but with byte masks in place of blends and vpcompressw in place of the shuffles */
+/* returns bytes consumed, which always end on a code point boundary, and stores bytes written in written */
+UNICODER_INLINE UNICODER_TARGET_AVX512 size_t unicoder_avx512_utf8ToUtf16(const unsigned char* p, unsigned char* q, size_t* written, unsigned int endianness)
+{
+	__m512i in, prev1, prev2, lo, hi, unitsA, unitsB;
+	__mmask64 cont0, cont1, lead4, high4, end4, keep;
+	unsigned int lastEnd;
+	size_t n;
+
+	in= _mm512_loadu_si512((const void*) p);
+
+	if(_mm512_movepi8_mask(in) == 0)
+	{
+		unitsA= _mm512_cvtepu8_epi16(_mm512_castsi512_si256(in));
+		unitsB= _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(in, 1));
+
+		if(endianness == UNICODER_BES)
+		{
+			unitsA= _mm512_slli_epi16(unitsA, 8);
+			unitsB= _mm512_slli_epi16(unitsB, 8);
+		}
+
+		_mm512_storeu_si512((void*) q, unitsA);
+		_mm512_storeu_si512((void*) (q + 64), unitsB);
+		*written= 128;
+		return 64;
+	}
+
+	/* byte i ends a code point when byte i + 1 is not a continuation, the last byte can't tell */
+	cont0= _mm512_cmplt_epi8_mask(in, _mm512_set1_epi8(-64));
+	keep= ~(cont0 >> 1) & 0x7fffffffffffffffull;
+	lastEnd= unicoder_highestBit64(keep);
+
+	/* lanes 0..2 moved up one lane with zeros below, then alignr pulls in the n bytes before */
+	prev1= _mm512_alignr_epi8(in, _mm512_alignr_epi64(in, _mm512_setzero_si512(), 6), 15);
+	prev2= _mm512_alignr_epi8(in, _mm512_alignr_epi64(in, _mm512_setzero_si512(), 6), 14);
+	cont1= cont0 << 1;
+
+	/* low byte: 7 bits of an ascii byte or 6 of a continuation, plus 2 from the byte before */
+	lo= _mm512_and_si512(in, _mm512_set1_epi8(0x7f));
+	lo= _mm512_or_si512(lo, _mm512_maskz_mov_epi8(cont0, _mm512_and_si512(_mm512_slli_epi16(prev1, 6), _mm512_set1_epi8((char) 0xc0))));
+
+	/* high byte: the other 4 bits of the byte before, plus the lead of a 3 byte sequence */
+	hi= _mm512_and_si512(_mm512_srli_epi16(prev1, 2), _mm512_set1_epi8(0x0f));
+	hi= _mm512_or_si512(hi, _mm512_maskz_mov_epi8(cont1, _mm512_and_si512(_mm512_slli_epi16(prev2, 4), _mm512_set1_epi8((char) 0xf0))));
+	hi= _mm512_maskz_mov_epi8(cont0, hi);
+
+	lead4= _mm512_cmpge_epu8_mask(in, _mm512_set1_epi8((char) 0xf0));
+	high4= lead4 << 2;
+	if(lead4 != 0)
+	{
+		__m512i highLo, highHi;
+
+		end4= lead4 << 3;
+		keep |= high4;
+
+		/* the low surrogate keeps its 10 bits and takes DC in the top 6 */
+		hi= _mm512_mask_mov_epi8(hi, end4, _mm512_or_si512(_mm512_and_si512(hi, _mm512_set1_epi8(0x03)), _mm512_set1_epi8((char) 0xdc)));
+
+		/* the high surrogate is D7C0 plus bits 20..10 of the code point, from bytes 1, 2 and 3 */
+		highLo= _mm512_or_si512(_mm512_and_si512(_mm512_slli_epi16(prev1, 2), _mm512_set1_epi8((char) 0xfc)),
+		                        _mm512_and_si512(_mm512_srli_epi16(in, 4), _mm512_set1_epi8(0x03)));
+		highHi= _mm512_and_si512(prev2, _mm512_set1_epi8(0x07));
+		lo= _mm512_mask_mov_epi8(lo, high4, highLo);
+		hi= _mm512_mask_mov_epi8(hi, high4, highHi);
+	}
+
+	/* widening keeps the units in order: A holds positions 0..31, B holds 32..63 */
+	unitsA= _mm512_or_si512(_mm512_cvtepu8_epi16(_mm512_castsi512_si256(lo)),
+	                        _mm512_slli_epi16(_mm512_cvtepu8_epi16(_mm512_castsi512_si256(hi)), 8));
+	unitsB= _mm512_or_si512(_mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(lo, 1)),
+	                        _mm512_slli_epi16(_mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(hi, 1)), 8));
+
+	if(lead4 != 0)
+	{
+		unitsA= _mm512_mask_add_epi16(unitsA, (__mmask32) high4, unitsA, _mm512_set1_epi16((short) 0xd7c0));
+		unitsB= _mm512_mask_add_epi16(unitsB, (__mmask32) (high4 >> 32), unitsB, _mm512_set1_epi16((short) 0xd7c0));
+	}
+
+	/* a surrogate slot past the last complete sequence belongs to the next window */
+	keep &= (2ull << lastEnd) - 1;
+
+	if(endianness == UNICODER_BES)
+	{
+		unitsA= _mm512_or_si512(_mm512_slli_epi16(unitsA, 8), _mm512_srli_epi16(unitsA, 8));
+		unitsB= _mm512_or_si512(_mm512_slli_epi16(unitsB, 8), _mm512_srli_epi16(unitsB, 8));
+	}
+
+	_mm512_storeu_si512((void*) q, _mm512_maskz_compress_epi16((__mmask32) keep, unitsA));
+	n= 2 * (size_t) unicoder_bitCount64(keep & 0xffffffffull);
+	_mm512_storeu_si512((void*) (q + n), _mm512_maskz_compress_epi16((__mmask32) (keep >> 32), unitsB));
+	n += 2 * (size_t) unicoder_bitCount64(keep >> 32);
+
+	*written= n;
+	return lastEnd + 1;
+}
+
+#endif
+
+
+/* ends a chunk near p + UNICODER_CHUNK, backing up so it does not split a sequence */
+UNICODER_INLINE size_t unicoder_utf8_chunkEnd(const unsigned char* src, size_t in, size_t srcLen)
+{
+	size_t end, i;
+
+	if(srcLen - in <= UNICODER_CHUNK)
+		return srcLen;
+
+	end= in + UNICODER_CHUNK;
+	for(i= 0; i < 3  &&  (src[end] & 0xc0) == 0x80; i++)
+		end--;
+
+	return end;
+}
+
+
+/* stamps out the chunk loop around one tier's kernel and checker, window is what the kernel */
+/* reads and room what it may write */
+#define  UNICODER_DEFINE_UTF8_TO_UTF16(tier, target, window, room)                     \
+UNICODER_INLINE target int unicoder_##tier##_transcodeUtf8ToUtf16(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced,           \
+                                         unsigned int endianness)                      \
+{                                                                                      \
+	size_t in= 0, out= 0, chunkEnd, validEnd, written;                                 \
+	int bytesRead, bytesWritten, ret= 0;                                               \
+	unsigned int x;                                                                    \
+                                                                                       \
+	while(in < srcLen)                                                                 \
+	{                                                                                  \
+		chunkEnd= unicoder_utf8_chunkEnd(src, in, srcLen);                             \
+		validEnd= in + unicoder_##tier##_utf8FindErrorBlock(src + in, chunkEnd - in);  \
+                                                                                       \
+		while(validEnd - in >= (window)  &&  dstCap - out >= (room))                   \
+		{                                                                              \
+			in += unicoder_##tier##_utf8ToUtf16(src + in, dst + out, &written, endianness); \
+			out += written;                                                            \
+		}                                                                              \
+                                                                                       \
+		/* the tail of the chunk, or the lead up to an error the checker found */      \
+		while(in < chunkEnd)                                                           \
+		{                                                                              \
+			bytesRead= unicoder_utf8_read(src + in, srcLen - in, &x);                  \
+			if(bytesRead < 0)                                                          \
+			{                                                                          \
+				ret= bytesRead;                                                        \
+				break;                                                                 \
+			}                                                                          \
+                                                                                       \
+			bytesWritten= unicoder_utf16_write(dst + out, dstCap - out, x, endianness); \
+			if(bytesWritten < 0)                                                       \
+			{                                                                          \
+				ret= bytesWritten;                                                     \
+				break;                                                                 \
+			}                                                                          \
+                                                                                       \
+			in += bytesRead;                                                           \
+			out += bytesWritten;                                                       \
+		}                                                                              \
+                                                                                       \
+		if(ret != 0)                                                                   \
+			break;                                                                     \
+	}                                                                                  \
+                                                                                       \
+	*consumed= in;                                                                     \
+	*produced= out;                                                                    \
+	return ret;                                                                        \
+}                                                                                      \
+                                                                                       \
+static target int unicoder_##tier##_transcode_utf8_utf16be(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced)           \
+{                                                                                      \
+	return unicoder_##tier##_transcodeUtf8ToUtf16(src, srcLen, dst, dstCap, consumed, produced, UNICODER_BES); \
+}                                                                                      \
+                                                                                       \
+static target int unicoder_##tier##_transcode_utf8_utf16le(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced)           \
+{                                                                                      \
+	return unicoder_##tier##_transcodeUtf8ToUtf16(src, srcLen, dst, dstCap, consumed, produced, UNICODER_LES); \
+}
+
+#if defined(UNICODER_SSE)
+UNICODER_DEFINE_UTF8_TO_UTF16(sse, UNICODER_TARGET_SSE, 16, 32)
+#endif
+
+#if defined(UNICODER_AVX2)
+UNICODER_DEFINE_UTF8_TO_UTF16(avx2, UNICODER_TARGET_AVX2, 32, 64)
+#endif
+
+#if defined(UNICODER_AVX512)
+UNICODER_DEFINE_UTF8_TO_UTF16(avx512, UNICODER_TARGET_AVX512, 64, 128)
+#endif
+
+#endif
+
+
+
+/*
+utf-16 to utf-8.
+
+Runs of ascii are narrowed 16, 32 or 64 units at a time. Otherwise the kernel builds every unit's
+utf-8 bytes in its own lane and packs the real bytes together with unicoder_compressIndex (or
+vpcompressb on avx-512):
+16 bit lanes when nothing needs more than 2 bytes, 32 bit lanes when something does. A high
+surrogate is combined with the unit after it in the same lane (the low surrogate's lane then
+keeps no bytes), using the same arithmetic as unicoder_utf16_decode. A window with a surrogate
+that has no partner goes to the scalar steps, which report it at its exact offset.
+*/
+
+#if defined(UNICODER_SIMD)
+
+/* packs the bytes of one 8 byte half (0 or 8) of bytes selected by mask to p, returns bytes stored */
+UNICODER_INLINE UNICODER_TARGET_SSE size_t unicoder_sse_compressStore8(unsigned char* p, __m128i bytes, unsigned int mask, int half)
+{
+	__m128i index;
+
+	index= _mm_loadl_epi64((const __m128i*) unicoder_compressIndex[mask]);
+	index= _mm_add_epi8(index, _mm_set1_epi8((char) half));
+
+	_mm_storel_epi64((__m128i*) p, _mm_shuffle_epi8(bytes, index));
+	return unicoder_bitCount[mask];
+}
+
+
+/* packs the bytes of lanes selected by mask, one bit per byte, to p, returns bytes stored */
+UNICODER_INLINE UNICODER_TARGET_SSE size_t unicoder_sse_compressStoreBytes(unsigned char* p, __m128i bytes, unsigned int mask)
+{
+	size_t n;
+
+	n= unicoder_sse_compressStore8(p, bytes, mask & 0xff, 0);
+	n += unicoder_sse_compressStore8(p + n, bytes, (mask >> 8) & 0xff, 8);
+	return n;
+}
+
+
+/* code points to utf-8, one per 32 bit lane with its bytes in memory order, and which bytes are real */
+UNICODER_INLINE UNICODER_TARGET_SSE __m128i unicoder_sse_utf8Lanes(__m128i cp, unsigned int* keep)
+{
+	__m128i over7f, over7ff, overffff, bytes, two, three, four, real;
+
+	over7f= _mm_cmpgt_epi32(cp, _mm_set1_epi32(0x7f));
+	over7ff= _mm_cmpgt_epi32(cp, _mm_set1_epi32(0x07ff));
+	overffff= _mm_cmpgt_epi32(cp, _mm_set1_epi32(0xffff));
+
+	two= _mm_or_si128(_mm_set1_epi32(0x80c0), _mm_slli_epi32(_mm_and_si128(cp, _mm_set1_epi32(0x3f)), 8));
+	two= _mm_or_si128(two, _mm_srli_epi32(cp, 6));
+
+	three= _mm_or_si128(_mm_set1_epi32(0x8080e0), _mm_slli_epi32(_mm_and_si128(cp, _mm_set1_epi32(0x3f)), 16));
+	three= _mm_or_si128(three, _mm_and_si128(_mm_slli_epi32(cp, 2), _mm_set1_epi32(0x3f00)));
+	three= _mm_or_si128(three, _mm_srli_epi32(cp, 12));
+
+	bytes= _mm_blendv_epi8(cp, two, over7f);
+	bytes= _mm_blendv_epi8(bytes, three, over7ff);
+
+	if(_mm_movemask_epi8(overffff) != 0)
+	{
+		four= _mm_or_si128(_mm_set1_epi32((int) 0x808080f0), _mm_slli_epi32(_mm_and_si128(cp, _mm_set1_epi32(0x3f)), 24));
+		four= _mm_or_si128(four, _mm_and_si128(_mm_slli_epi32(cp, 10), _mm_set1_epi32(0x3f0000)));
+		four= _mm_or_si128(four, _mm_and_si128(_mm_srli_epi32(cp, 4), _mm_set1_epi32(0x3f00)));
+		four= _mm_or_si128(four, _mm_srli_epi32(cp, 18));
+		bytes= _mm_blendv_epi8(bytes, four, overffff);
+	}
+
+	real= _mm_or_si128(_mm_set1_epi32(0xff), _mm_and_si128(over7f, _mm_set1_epi32(0xff00)));
+	real= _mm_or_si128(real, _mm_and_si128(over7ff, _mm_set1_epi32(0xff0000)));
+	real= _mm_or_si128(real, _mm_and_si128(overffff, _mm_set1_epi32((int) 0xff000000)));
+
+	*keep= (unsigned int) _mm_movemask_epi8(real);
+	return bytes;
+}
+
+
+/* same as unicoder_utf16_decode: ((high - 0xd800) << 10) + (low - 0xdc00) + 0x10000 */
+#define  UNICODER_SURROGATE_OFFSET  ((0xd800 << 10) + 0xdc00 - 0x010000)
+
+
+#if defined(UNICODER_SSE)
+
+/* converts up to 16 units of valid utf-16 at p (32 bytes must be readable) into at most 32 bytes at q */
+/* returns bytes consumed and stores bytes written in written, or returns 0 if a surrogate is unpaired */
+UNICODER_INLINE UNICODER_TARGET_SSE size_t unicoder_sse_utf16ToUtf8(const unsigned char* p, unsigned char* q, size_t* written, unsigned int endianness)
+{
+	__m128i units, units1, next, high, low, cp, bytes, drop;
+	unsigned int highMask, lowMask, keep, used;
+	const __m128i zero= _mm_setzero_si128();
+	const __m128i surrogateBits= _mm_set1_epi16((short) 0xfc00);
+	size_t n;
+
+	units= _mm_loadu_si128((const __m128i*) p);
+	units1= _mm_loadu_si128((const __m128i*) (p + 16));
+
+	/* ascii is checked on the raw bytes, so big endian pays for a swap only when it has to */
+	if(endianness == UNICODER_LES)
+	{
+		if(_mm_testz_si128(_mm_or_si128(units, units1), _mm_set1_epi16((short) 0xff80)))
+		{
+			_mm_storeu_si128((__m128i*) q, _mm_packus_epi16(units, units1));
+			*written= 16;
+			return 32;
+		}
+	}
+
+	else
+	{
+		if(_mm_testz_si128(_mm_or_si128(units, units1), _mm_set1_epi16((short) 0x80ff)))
+		{
+			_mm_storeu_si128((__m128i*) q, _mm_packus_epi16(_mm_srli_epi16(units, 8), _mm_srli_epi16(units1, 8)));
+			*written= 16;
+			return 32;
+		}
+
+		units= unicoder_sse_swap16(units);
+	}
+
+	/* nothing past 0x7ff: 1 or 2 bytes per unit in 16 bit lanes */
+	if(_mm_testz_si128(units, _mm_set1_epi16((short) 0xf800)))
+	{
+		__m128i ascii, two;
+
+		ascii= _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short) 0xff80)), zero);
+		two= _mm_or_si128(_mm_set1_epi16((short) 0x80c0), _mm_slli_epi16(_mm_and_si128(units, _mm_set1_epi16(0x3f)), 8));
+		two= _mm_or_si128(two, _mm_srli_epi16(units, 6));
+		bytes= _mm_blendv_epi8(two, units, ascii);
+
+		keep= (unsigned int) _mm_movemask_epi8(_mm_or_si128(_mm_andnot_si128(ascii, _mm_set1_epi16((short) 0xff00)),
+		                                                    _mm_set1_epi16(0x00ff)));
+
+		*written= unicoder_sse_compressStoreBytes(q, bytes, keep);
+		return 16;
+	}
+
+	high= _mm_cmpeq_epi16(_mm_and_si128(units, surrogateBits), _mm_set1_epi16((short) 0xd800));
+	low= _mm_cmpeq_epi16(_mm_and_si128(units, surrogateBits), _mm_set1_epi16((short) 0xdc00));
+	highMask= (unsigned int) _mm_movemask_epi8(high);
+	lowMask= (unsigned int) _mm_movemask_epi8(low);
+	used= 16;
+	next= zero;
+
+	if((highMask | lowMask) != 0)
+	{
+		next= _mm_loadu_si128((const __m128i*) (p + 2));
+		if(endianness == UNICODER_BES)
+			next= unicoder_sse_swap16(next);
+
+		/* every high surrogate needs a low one right after it, and the low ones need nothing else */
+		if(highMask != (unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(next, surrogateBits),
+		                                                                _mm_set1_epi16((short) 0xdc00)))
+		   ||  (lowMask & 0x3) != 0)
+			return 0;
+
+		/* a pair split by the window waits for the next one */
+		if(highMask & 0x8000)
+			used= 14;
+	}
+
+	/* 1 to 4 bytes per unit in 32 bit lanes, half a window at a time */
+	cp= _mm_cvtepu16_epi32(units);
+	drop= _mm_cvtepi16_epi32(low);
+	if(highMask != 0)
+		cp= _mm_blendv_epi8(cp, _mm_sub_epi32(_mm_add_epi32(_mm_slli_epi32(cp, 10), _mm_cvtepu16_epi32(next)),
+		                                      _mm_set1_epi32(UNICODER_SURROGATE_OFFSET)),
+		                    _mm_cvtepi16_epi32(high));
+	bytes= unicoder_sse_utf8Lanes(cp, &keep);
+	keep &= ~(unsigned int) _mm_movemask_epi8(drop);
+	n= unicoder_sse_compressStoreBytes(q, bytes, keep);
+
+	cp= _mm_cvtepu16_epi32(_mm_unpackhi_epi64(units, units));
+	drop= _mm_cvtepi16_epi32(_mm_unpackhi_epi64(low, low));
+	if(highMask != 0)
+		cp= _mm_blendv_epi8(cp, _mm_sub_epi32(_mm_add_epi32(_mm_slli_epi32(cp, 10), _mm_cvtepu16_epi32(_mm_unpackhi_epi64(next, next))),
+		                                      _mm_set1_epi32(UNICODER_SURROGATE_OFFSET)),
+		                    _mm_cvtepi16_epi32(_mm_unpackhi_epi64(high, high)));
+	bytes= unicoder_sse_utf8Lanes(cp, &keep);
+	keep &= ~(unsigned int) _mm_movemask_epi8(drop);
+	if(used == 14)
+		keep &= 0x0fff;
+	n += unicoder_sse_compressStoreBytes(q + n, bytes, keep);
+
+	*written= n;
+	return used;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX2)
+
+UNICODER_INLINE UNICODER_TARGET_AVX2 __m256i unicoder_avx2_swap16(__m256i units)
+{
+	return _mm256_or_si256(_mm256_slli_epi16(units, 8), _mm256_srli_epi16(units, 8));
+}
+
+
+/* code points to utf-8, one per 32 bit lane with its bytes in memory order, and which bytes are real */
+UNICODER_INLINE UNICODER_TARGET_AVX2 __m256i unicoder_avx2_utf8Lanes(__m256i cp, unsigned int* keep)
+{
+	__m256i over7f, over7ff, overffff, bytes, two, three, four, real;
+
+	over7f= _mm256_cmpgt_epi32(cp, _mm256_set1_epi32(0x7f));
+	over7ff= _mm256_cmpgt_epi32(cp, _mm256_set1_epi32(0x07ff));
+	overffff= _mm256_cmpgt_epi32(cp, _mm256_set1_epi32(0xffff));
+
+	two= _mm256_or_si256(_mm256_set1_epi32(0x80c0), _mm256_slli_epi32(_mm256_and_si256(cp, _mm256_set1_epi32(0x3f)), 8));
+	two= _mm256_or_si256(two, _mm256_srli_epi32(cp, 6));
+
+	three= _mm256_or_si256(_mm256_set1_epi32(0x8080e0), _mm256_slli_epi32(_mm256_and_si256(cp, _mm256_set1_epi32(0x3f)), 16));
+	three= _mm256_or_si256(three, _mm256_and_si256(_mm256_slli_epi32(cp, 2), _mm256_set1_epi32(0x3f00)));
+	three= _mm256_or_si256(three, _mm256_srli_epi32(cp, 12));
+
+	bytes= _mm256_blendv_epi8(cp, two, over7f);
+	bytes= _mm256_blendv_epi8(bytes, three, over7ff);
+
+	if(_mm256_movemask_epi8(overffff) != 0)
+	{
+		four= _mm256_or_si256(_mm256_set1_epi32((int) 0x808080f0), _mm256_slli_epi32(_mm256_and_si256(cp, _mm256_set1_epi32(0x3f)), 24));
+		four= _mm256_or_si256(four, _mm256_and_si256(_mm256_slli_epi32(cp, 10), _mm256_set1_epi32(0x3f0000)));
+		four= _mm256_or_si256(four, _mm256_and_si256(_mm256_srli_epi32(cp, 4), _mm256_set1_epi32(0x3f00)));
+		four= _mm256_or_si256(four, _mm256_srli_epi32(cp, 18));
+		bytes= _mm256_blendv_epi8(bytes, four, overffff);
+	}
+
+	real= _mm256_or_si256(_mm256_set1_epi32(0xff), _mm256_and_si256(over7f, _mm256_set1_epi32(0xff00)));
+	real= _mm256_or_si256(real, _mm256_and_si256(over7ff, _mm256_set1_epi32(0xff0000)));
+	real= _mm256_or_si256(real, _mm256_and_si256(overffff, _mm256_set1_epi32((int) 0xff000000)));
+
+	*keep= (unsigned int) _mm256_movemask_epi8(real);
+	return bytes;
+}
+
+
+/* packs the bytes of lanes selected by mask, one bit per byte, to p, returns bytes stored */
+UNICODER_INLINE UNICODER_TARGET_AVX2 size_t unicoder_avx2_compressStoreBytes(unsigned char* p, __m256i bytes, unsigned int mask)
+{
+	size_t n;
+
+	n= unicoder_sse_compressStoreBytes(p, _mm256_castsi256_si128(bytes), mask & 0xffff);
+	n += unicoder_sse_compressStoreBytes(p + n, _mm256_extracti128_si256(bytes, 1), mask >> 16);
+	return n;
+}
+
+
+/* converts up to 32 units of valid utf-16 at p (64 bytes must be readable) into at most 64 bytes at q */
+/* returns bytes consumed and stores bytes written in written, or returns 0 if a surrogate is unpaired */
+UNICODER_INLINE UNICODER_TARGET_AVX2 size_t unicoder_avx2_utf16ToUtf8(const unsigned char* p, unsigned char* q, size_t* written, unsigned int endianness)
+{
+	__m256i units, units1, next, high, low, cp, bytes, drop;
+	unsigned int highMask, lowMask, keep, used;
+	const __m256i zero= _mm256_setzero_si256();
+	const __m256i surrogateBits= _mm256_set1_epi16((short) 0xfc00);
+	size_t n;
+
+	units= _mm256_loadu_si256((const __m256i*) p);
+	units1= _mm256_loadu_si256((const __m256i*) (p + 32));
+
+	/* ascii is checked on the raw bytes, so big endian pays for a swap only when it has to */
+	if(endianness == UNICODER_LES)
+	{
+		if(_mm256_testz_si256(_mm256_or_si256(units, units1), _mm256_set1_epi16((short) 0xff80)))
+		{
+			/* packus works per lane, the permute puts the quarters back in order */
+			_mm256_storeu_si256((__m256i*) q, _mm256_permute4x64_epi64(_mm256_packus_epi16(units, units1), 0xd8));
+			*written= 32;
+			return 64;
+		}
+	}
+
+	else
+	{
+		if(_mm256_testz_si256(_mm256_or_si256(units, units1), _mm256_set1_epi16((short) 0x80ff)))
+		{
+			_mm256_storeu_si256((__m256i*) q, _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_srli_epi16(units, 8),
+			                                                                               _mm256_srli_epi16(units1, 8)), 0xd8));
+			*written= 32;
+			return 64;
+		}
+
+		units= unicoder_avx2_swap16(units);
+	}
+
+	/* nothing past 0x7ff: 1 or 2 bytes per unit in 16 bit lanes */
+	if(_mm256_testz_si256(units, _mm256_set1_epi16((short) 0xf800)))
+	{
+		__m256i ascii, two;
+
+		ascii= _mm256_cmpeq_epi16(_mm256_and_si256(units, _mm256_set1_epi16((short) 0xff80)), zero);
+		two= _mm256_or_si256(_mm256_set1_epi16((short) 0x80c0), _mm256_slli_epi16(_mm256_and_si256(units, _mm256_set1_epi16(0x3f)), 8));
+		two= _mm256_or_si256(two, _mm256_srli_epi16(units, 6));
+		bytes= _mm256_blendv_epi8(two, units, ascii);
+
+		keep= (unsigned int) _mm256_movemask_epi8(_mm256_or_si256(_mm256_andnot_si256(ascii, _mm256_set1_epi16((short) 0xff00)),
+		                                                          _mm256_set1_epi16(0x00ff)));
+
+		*written= unicoder_avx2_compressStoreBytes(q, bytes, keep);
+		return 32;
+	}
+
+	high= _mm256_cmpeq_epi16(_mm256_and_si256(units, surrogateBits), _mm256_set1_epi16((short) 0xd800));
+	low= _mm256_cmpeq_epi16(_mm256_and_si256(units, surrogateBits), _mm256_set1_epi16((short) 0xdc00));
+	highMask= (unsigned int) _mm256_movemask_epi8(high);
+	lowMask= (unsigned int) _mm256_movemask_epi8(low);
+	used= 32;
+	next= zero;
+
+	if((highMask | lowMask) != 0)
+	{
+		next= _mm256_loadu_si256((const __m256i*) (p + 2));
+		if(endianness == UNICODER_BES)
+			next= unicoder_avx2_swap16(next);
+
+		/* every high surrogate needs a low one right after it, and the low ones need nothing else */
+		if(highMask != (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(next, surrogateBits),
+		                                                                      _mm256_set1_epi16((short) 0xdc00)))
+		   ||  (lowMask & 0x3) != 0)
+			return 0;
+
+		/* a pair split by the window waits for the next one */
+		if(highMask & 0x80000000u)
+			used= 30;
+	}
+
+	/* 1 to 4 bytes per unit in 32 bit lanes, half a window at a time */
+	cp= _mm256_cvtepu16_epi32(_mm256_castsi256_si128(units));
+	drop= _mm256_cvtepi16_epi32(_mm256_castsi256_si128(low));
+	if(highMask != 0)
+		cp= _mm256_blendv_epi8(cp, _mm256_sub_epi32(_mm256_add_epi32(_mm256_slli_epi32(cp, 10),
+		                                                             _mm256_cvtepu16_epi32(_mm256_castsi256_si128(next))),
+		                                            _mm256_set1_epi32(UNICODER_SURROGATE_OFFSET)),
+		                       _mm256_cvtepi16_epi32(_mm256_castsi256_si128(high)));
+	bytes= unicoder_avx2_utf8Lanes(cp, &keep);
+	keep &= ~(unsigned int) _mm256_movemask_epi8(drop);
+	n= unicoder_avx2_compressStoreBytes(q, bytes, keep);
+
+	cp= _mm256_cvtepu16_epi32(_mm256_extracti128_si256(units, 1));
+	drop= _mm256_cvtepi16_epi32(_mm256_extracti128_si256(low, 1));
+	if(highMask != 0)
+		cp= _mm256_blendv_epi8(cp, _mm256_sub_epi32(_mm256_add_epi32(_mm256_slli_epi32(cp, 10),
+		                                                             _mm256_cvtepu16_epi32(_mm256_extracti128_si256(next, 1))),
+		                                            _mm256_set1_epi32(UNICODER_SURROGATE_OFFSET)),
+		                       _mm256_cvtepi16_epi32(_mm256_extracti128_si256(high, 1)));
+	bytes= unicoder_avx2_utf8Lanes(cp, &keep);
+	keep &= ~(unsigned int) _mm256_movemask_epi8(drop);
+	if(used == 30)
+		keep &= 0x0fffffff;
+	n += unicoder_avx2_compressStoreBytes(q + n, bytes, keep);
+
+	*written= n;
+	return used;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX512)
+
+UNICODER_INLINE UNICODER_TARGET_AVX512 __m512i unicoder_avx512_swap16(__m512i units)
+{
+	return _mm512_or_si512(_mm512_slli_epi16(units, 8), _mm512_srli_epi16(units, 8));
+}
+
+
+/* code points to utf-8, one per 32 bit lane with its bytes in memory order, and which bytes of */
+/* the lanes in live are real */
+UNICODER_INLINE UNICODER_TARGET_AVX512 __m512i unicoder_avx512_utf8Lanes(__m512i cp, __mmask16 live, __mmask64* keep)
+{
+	__m512i bytes, two, three, four, real;
+	__mmask16 over7f, over7ff, overffff;
+
+	over7f= _mm512_cmpgt_epu32_mask(cp, _mm512_set1_epi32(0x7f));
+	over7ff= _mm512_cmpgt_epu32_mask(cp, _mm512_set1_epi32(0x07ff));
+	overffff= _mm512_cmpgt_epu32_mask(cp, _mm512_set1_epi32(0xffff));
+
+	two= _mm512_or_si512(_mm512_set1_epi32(0x80c0), _mm512_slli_epi32(_mm512_and_si512(cp, _mm512_set1_epi32(0x3f)), 8));
+	two= _mm512_or_si512(two, _mm512_srli_epi32(cp, 6));
+
+	three= _mm512_or_si512(_mm512_set1_epi32(0x8080e0), _mm512_slli_epi32(_mm512_and_si512(cp, _mm512_set1_epi32(0x3f)), 16));
+	three= _mm512_or_si512(three, _mm512_and_si512(_mm512_slli_epi32(cp, 2), _mm512_set1_epi32(0x3f00)));
+	three= _mm512_or_si512(three, _mm512_srli_epi32(cp, 12));
+
+	bytes= _mm512_mask_mov_epi32(cp, over7f, two);
+	bytes= _mm512_mask_mov_epi32(bytes, over7ff, three);
+
+	if(overffff != 0)
+	{
+		four= _mm512_or_si512(_mm512_set1_epi32((int) 0x808080f0), _mm512_slli_epi32(_mm512_and_si512(cp, _mm512_set1_epi32(0x3f)), 24));
+		four= _mm512_or_si512(four, _mm512_and_si512(_mm512_slli_epi32(cp, 10), _mm512_set1_epi32(0x3f0000)));
+		four= _mm512_or_si512(four, _mm512_and_si512(_mm512_srli_epi32(cp, 4), _mm512_set1_epi32(0x3f00)));
+		four= _mm512_or_si512(four, _mm512_srli_epi32(cp, 18));
+		bytes= _mm512_mask_mov_epi32(bytes, overffff, four);
+	}
+
+	real= _mm512_mask_mov_epi32(_mm512_set1_epi32(0xff), over7f, _mm512_set1_epi32(0xffff));
+	real= _mm512_mask_mov_epi32(real, over7ff, _mm512_set1_epi32(0xffffff));
+	real= _mm512_mask_mov_epi32(real, overffff, _mm512_set1_epi32(-1));
+	real= _mm512_maskz_mov_epi32(live, real);
+
+	*keep= _mm512_test_epi8_mask(real, real);
+	return bytes;
+}
+
+
+/* converts up to 64 units of valid utf-16 at p (128 bytes must be readable) into at most 128 bytes at q, */
+/* the ascii run takes all 64 units and anything else the first 32, packed with vpcompressb */
+/* returns bytes consumed and stores bytes written in written, or returns 0 if a surrogate is unpaired */
+UNICODER_INLINE UNICODER_TARGET_AVX512 size_t unicoder_avx512_utf16ToUtf8(const unsigned char* p, unsigned char* q, size_t* written, unsigned int endianness)
+{
+	__m512i units, units1, next, cp, bytes;
+	__mmask32 high, low, ascii;
+	__mmask64 keep;
+	__mmask16 live;
+	unsigned int used, half;
+	size_t n;
+
+	units= _mm512_loadu_si512((const void*) p);
+	units1= _mm512_loadu_si512((const void*) (p + 64));
+
+	/* ascii is checked on the raw bytes, so big endian pays for a swap only when it has to */
+	if(endianness == UNICODER_LES)
+	{
+		if(_mm512_test_epi16_mask(_mm512_or_si512(units, units1), _mm512_set1_epi16((short) 0xff80)) == 0)
+		{
+			_mm256_storeu_si256((__m256i*) q, _mm512_cvtepi16_epi8(units));
+			_mm256_storeu_si256((__m256i*) (q + 32), _mm512_cvtepi16_epi8(units1));
+			*written= 64;
+			return 128;
+		}
+	}
+
+	else
+	{
+		if(_mm512_test_epi16_mask(_mm512_or_si512(units, units1), _mm512_set1_epi16((short) 0x80ff)) == 0)
+		{
+			_mm256_storeu_si256((__m256i*) q, _mm512_cvtepi16_epi8(_mm512_srli_epi16(units, 8)));
+			_mm256_storeu_si256((__m256i*) (q + 32), _mm512_cvtepi16_epi8(_mm512_srli_epi16(units1, 8)));
+			*written= 64;
+			return 128;
+		}
+
+		units= unicoder_avx512_swap16(units);
+	}
+
+	/* nothing past 0x7ff: 1 or 2 bytes per unit in 16 bit lanes */
+	if(_mm512_test_epi16_mask(units, _mm512_set1_epi16((short) 0xf800)) == 0)
+	{
+		__m512i two;
+
+		ascii= _mm512_testn_epi16_mask(units, _mm512_set1_epi16((short) 0xff80));
+		two= _mm512_or_si512(_mm512_set1_epi16((short) 0x80c0), _mm512_slli_epi16(_mm512_and_si512(units, _mm512_set1_epi16(0x3f)), 8));
+		two= _mm512_or_si512(two, _mm512_srli_epi16(units, 6));
+		bytes= _mm512_mask_mov_epi16(two, ascii, units);
+
+		keep= _mm512_movepi8_mask(_mm512_mask_mov_epi16(_mm512_set1_epi16(-1), ascii, _mm512_set1_epi16(0x00ff)));
+
+		_mm512_storeu_si512((void*) q, _mm512_maskz_compress_epi8(keep, bytes));
+		*written= unicoder_bitCount64(keep);
+		return 64;
+	}
+
+	high= _mm512_cmpeq_epi16_mask(_mm512_and_si512(units, _mm512_set1_epi16((short) 0xfc00)), _mm512_set1_epi16((short) 0xd800));
+	low= _mm512_cmpeq_epi16_mask(_mm512_and_si512(units, _mm512_set1_epi16((short) 0xfc00)), _mm512_set1_epi16((short) 0xdc00));
+	used= 64;
+	next= _mm512_setzero_si512();
+
+	if((high | low) != 0)
+	{
+		next= _mm512_loadu_si512((const void*) (p + 2));
+		if(endianness == UNICODER_BES)
+			next= unicoder_avx512_swap16(next);
+
+		/* every high surrogate needs a low one right after it, and the low ones need nothing else */
+		if(high != _mm512_cmpeq_epi16_mask(_mm512_and_si512(next, _mm512_set1_epi16((short) 0xfc00)), _mm512_set1_epi16((short) 0xdc00))
+		   ||  (low & 1) != 0)
+			return 0;
+
+		/* a pair split by the window waits for the next one */
+		if(high & 0x80000000u)
+			used= 62;
+	}
+
+	/* 1 to 4 bytes per unit in 32 bit lanes, half a window at a time */
+	n= 0;
+	for(half= 0; half < 2; half++)
+	{
+		if(half == 0)
+			cp= _mm512_cvtepu16_epi32(_mm512_castsi512_si256(units));
+		else
+			cp= _mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(units, 1));
+
+		if(high != 0)
+			cp= _mm512_mask_sub_epi32(cp, (__mmask16) (high >> (16 * half)),
+			                          _mm512_add_epi32(_mm512_slli_epi32(cp, 10),
+			                                           _mm512_cvtepu16_epi32(half == 0 ? _mm512_castsi512_si256(next)
+			                                                                           : _mm512_extracti64x4_epi64(next, 1))),
+			                          _mm512_set1_epi32(UNICODER_SURROGATE_OFFSET));
+
+		live= (__mmask16) ~(low >> (16 * half));
+		if(half == 1  &&  used == 62)
+			live &= 0x7fff;
+
+		bytes= unicoder_avx512_utf8Lanes(cp, live, &keep);
+		_mm512_storeu_si512((void*) (q + n), _mm512_maskz_compress_epi8(keep, bytes));
+		n += unicoder_bitCount64(keep);
+	}
+
+	*written= n;
+	return used;
+}
+
+#endif
+
+
+/* stamps out the window loop around one tier's kernel, window is what the kernel reads and */
+/* room what it may write */
+#define  UNICODER_DEFINE_UTF16_TO_UTF8(tier, target, window, room)                     \
+UNICODER_INLINE target int unicoder_##tier##_transcodeUtf16ToUtf8(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced,           \
+                                         unsigned int endianness)                      \
+{                                                                                      \
+	size_t in= 0, out= 0, used, written, stop;                                         \
+	int bytesRead, bytesWritten, ret= 0;                                               \
+	unsigned int x;                                                                    \
+                                                                                       \
+	while(in < srcLen)                                                                 \
+	{                                                                                  \
+		if(srcLen - in >= (window)  &&  dstCap - out >= (room))                        \
+		{                                                                              \
+			used= unicoder_##tier##_utf16ToUtf8(src + in, dst + out, &written, endianness); \
+			if(used > 0)                                                               \
+			{                                                                          \
+				in += used;                                                            \
+				out += written;                                                        \
+				continue;                                                              \
+			}                                                                          \
+		}                                                                              \
+                                                                                       \
+		/* the tail, or a window the kernel turned down, one code point at a time */   \
+		stop= in + (window) / 2;                                                       \
+		while(in < srcLen  &&  in < stop)                                              \
+		{                                                                              \
+			bytesRead= unicoder_utf16_read(src + in, srcLen - in, &x, endianness);     \
+			if(bytesRead < 0)                                                          \
+			{                                                                          \
+				ret= bytesRead;                                                        \
+				break;                                                                 \
+			}                                                                          \
+                                                                                       \
+			bytesWritten= unicoder_utf8_write(dst + out, dstCap - out, x);             \
+			if(bytesWritten < 0)                                                       \
+			{                                                                          \
+				ret= bytesWritten;                                                     \
+				break;                                                                 \
+			}                                                                          \
+                                                                                       \
+			in += bytesRead;                                                           \
+			out += bytesWritten;                                                       \
+		}                                                                              \
+                                                                                       \
+		if(ret != 0)                                                                   \
+			break;                                                                     \
+	}                                                                                  \
+                                                                                       \
+	*consumed= in;                                                                     \
+	*produced= out;                                                                    \
+	return ret;                                                                        \
+}                                                                                      \
+                                                                                       \
+static target int unicoder_##tier##_transcode_utf16be_utf8(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced)           \
+{                                                                                      \
+	return unicoder_##tier##_transcodeUtf16ToUtf8(src, srcLen, dst, dstCap, consumed, produced, UNICODER_BES); \
+}                                                                                      \
+                                                                                       \
+static target int unicoder_##tier##_transcode_utf16le_utf8(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced)           \
+{                                                                                      \
+	return unicoder_##tier##_transcodeUtf16ToUtf8(src, srcLen, dst, dstCap, consumed, produced, UNICODER_LES); \
+}
+
+#if defined(UNICODER_SSE)
+UNICODER_DEFINE_UTF16_TO_UTF8(sse, UNICODER_TARGET_SSE, 32, 32)
+#endif
+
+#if defined(UNICODER_AVX2)
+UNICODER_DEFINE_UTF16_TO_UTF8(avx2, UNICODER_TARGET_AVX2, 64, 64)
+#endif
+
+#if defined(UNICODER_AVX512)
+UNICODER_DEFINE_UTF16_TO_UTF8(avx512, UNICODER_TARGET_AVX512, 128, 128)
+#endif
+
+#endif
+
+
+
+/*
+Latin-1 and utf-8.
+
+ISO-8859-1 is the first 256 code points, so going to utf-8 a byte below 0x80 stays as it is and
+one above becomes C2 or C3 followed by 80 | (b & 0x3f). The kernels build both bytes for every
+byte, interleave them into pairs and pack away the second byte of the ascii pairs with
+unicoder_compressIndex (vpcompressb on avx-512). Coming back, a window of ascii and C2/C3 pairs
+narrows the same way: a lead byte takes its two low bits and the six of the continuation after it,
+and the continuations are packed away. Any other byte above 0x7f, a longer sequence latin-1 has no
+byte for or a bad one, sends the window to the scalar steps, which report it at its exact offset.
+*/
+
+#if defined(UNICODER_SSE)
+
+/* converts 16 bytes of latin-1 at p into at most 32 bytes of utf-8 at q, returns bytes written */
+UNICODER_INLINE UNICODER_TARGET_SSE size_t unicoder_sse_latin1ToUtf8(const unsigned char* p, unsigned char* q)
+{
+	__m128i bytes, high, lead, cont, ones;
+	size_t n;
+
+	bytes= _mm_loadu_si128((const __m128i*) p);
+	if(_mm_movemask_epi8(bytes) == 0)
+	{
+		_mm_storeu_si128((__m128i*) q, bytes);
+		return 16;
+	}
+
+	high= _mm_cmplt_epi8(bytes, _mm_setzero_si128());
+	lead= _mm_or_si128(_mm_set1_epi8((char) 0xc0), _mm_and_si128(_mm_srli_epi16(bytes, 6), _mm_set1_epi8(0x03)));
+	lead= _mm_blendv_epi8(bytes, lead, high);
+	cont= _mm_or_si128(_mm_set1_epi8((char) 0x80), _mm_and_si128(bytes, _mm_set1_epi8(0x3f)));
+	ones= _mm_set1_epi8(-1);
+
+	n= unicoder_sse_compressStoreBytes(q, _mm_unpacklo_epi8(lead, cont),
+	                                   (unsigned int) _mm_movemask_epi8(_mm_unpacklo_epi8(ones, high)));
+	n += unicoder_sse_compressStoreBytes(q + n, _mm_unpackhi_epi8(lead, cont),
+	                                     (unsigned int) _mm_movemask_epi8(_mm_unpackhi_epi8(ones, high)));
+	return n;
+}
+
+
+/* converts up to 16 bytes of utf-8 at p holding nothing but ascii and C2/C3 pairs into at most 16 bytes */
+/* at q; returns bytes consumed and stores bytes written in written, or returns 0 if anything else is there */
+UNICODER_INLINE UNICODER_TARGET_SSE size_t unicoder_sse_utf8ToLatin1(const unsigned char* p, unsigned char* q, size_t* written)
+{
+	__m128i bytes, leads, value;
+	unsigned int high, lead, cont;
+	size_t used= 16;
+
+	bytes= _mm_loadu_si128((const __m128i*) p);
+	high= (unsigned int) _mm_movemask_epi8(bytes);
+	if(high == 0)
+	{
+		_mm_storeu_si128((__m128i*) q, bytes);
+		*written= 16;
+		return 16;
+	}
+
+	leads= _mm_cmpeq_epi8(_mm_and_si128(bytes, _mm_set1_epi8((char) 0xfe)), _mm_set1_epi8((char) 0xc2));
+	lead= (unsigned int) _mm_movemask_epi8(leads);
+	cont= (unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bytes, _mm_set1_epi8((char) 0xc0)),
+	                                                      _mm_set1_epi8((char) 0x80)));
+
+	/* a pair split by the window waits for the next one */
+	if(lead & 0x8000)
+	{
+		lead &= 0x7fff;
+		high &= 0x7fff;
+		used= 15;
+	}
+
+	if((lead | cont) != high  ||  (lead << 1) != cont)
+		return 0;
+
+	value= _mm_or_si128(_mm_and_si128(_mm_slli_epi16(bytes, 6), _mm_set1_epi8((char) 0xc0)),
+	                    _mm_and_si128(_mm_srli_si128(bytes, 1), _mm_set1_epi8(0x3f)));
+	value= _mm_blendv_epi8(bytes, value, leads);
+
+	*written= unicoder_sse_compressStoreBytes(q, value, ~cont & ((1u << used) - 1));
+	return used;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX2)
+
+/* same as unicoder_sse_latin1ToUtf8 for 32 bytes at p, at most 64 bytes at q */
+UNICODER_INLINE UNICODER_TARGET_AVX2 size_t unicoder_avx2_latin1ToUtf8(const unsigned char* p, unsigned char* q)
+{
+	__m256i bytes;
+	size_t n;
+
+	bytes= _mm256_loadu_si256((const __m256i*) p);
+	if(_mm256_movemask_epi8(bytes) == 0)
+	{
+		_mm256_storeu_si256((__m256i*) q, bytes);
+		return 32;
+	}
+
+	n= unicoder_sse_latin1ToUtf8(p, q);
+	n += unicoder_sse_latin1ToUtf8(p + 16, q + n);
+	return n;
+}
+
+
+/* same as unicoder_sse_utf8ToLatin1 for up to 32 bytes at p, at most 32 bytes at q */
+UNICODER_INLINE UNICODER_TARGET_AVX2 size_t unicoder_avx2_utf8ToLatin1(const unsigned char* p, unsigned char* q, size_t* written)
+{
+	__m256i bytes;
+	size_t used, more, n;
+
+	bytes= _mm256_loadu_si256((const __m256i*) p);
+	if(_mm256_movemask_epi8(bytes) == 0)
+	{
+		_mm256_storeu_si256((__m256i*) q, bytes);
+		*written= 32;
+		return 32;
+	}
+
+	used= unicoder_sse_utf8ToLatin1(p, q, written);
+	if(used == 0)
+		return 0;
+
+	more= unicoder_sse_utf8ToLatin1(p + used, q + *written, &n);
+	if(more > 0)
+	{
+		used += more;
+		*written += n;
+	}
+
+	return used;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX512)
+
+/* same as unicoder_sse_latin1ToUtf8 for 64 bytes at p, at most 128 bytes at q */
+static UNICODER_TARGET_AVX512 size_t unicoder_avx512_latin1ToUtf8(const unsigned char* p, unsigned char* q)
+{
+	__m512i bytes, wide, pairs, real;
+	__mmask64 high, keep;
+	__mmask32 highHalf;
+	size_t n= 0;
+	int half;
+
+	bytes= _mm512_loadu_si512((const void*) p);
+	high= _mm512_movepi8_mask(bytes);
+	if(high == 0)
+	{
+		_mm512_storeu_si512((void*) q, bytes);
+		return 64;
+	}
+
+	/* each byte in a 16 bit lane, lead byte first, and which of the two are real */
+	for(half= 0; half < 2; half++)
+	{
+		wide= _mm512_cvtepu8_epi16(half == 0 ? _mm512_castsi512_si256(bytes) : _mm512_extracti64x4_epi64(bytes, 1));
+		highHalf= (__mmask32) (high >> (32 * half));
+
+		pairs= _mm512_or_si512(_mm512_srli_epi16(wide, 6), _mm512_slli_epi16(_mm512_and_si512(wide, _mm512_set1_epi16(0x3f)), 8));
+		pairs= _mm512_mask_mov_epi16(wide, highHalf, _mm512_or_si512(pairs, _mm512_set1_epi16((short) 0x80c0)));
+		real= _mm512_mask_mov_epi16(_mm512_set1_epi16(0x00ff), highHalf, _mm512_set1_epi16(-1));
+
+		keep= _mm512_movepi8_mask(real);
+		_mm512_storeu_si512((void*) (q + n), _mm512_maskz_compress_epi8(keep, pairs));
+		n += unicoder_bitCount64(keep);
+	}
+
+	return n;
+}
+
+
+/* same as unicoder_sse_utf8ToLatin1 for up to 64 bytes at p, at most 64 bytes at q */
+static UNICODER_TARGET_AVX512 size_t unicoder_avx512_utf8ToLatin1(const unsigned char* p, unsigned char* q, size_t* written)
+{
+	__m512i bytes, next, value;
+	__mmask64 high, lead, cont, keep;
+	size_t used= 64;
+
+	bytes= _mm512_loadu_si512((const void*) p);
+	high= _mm512_movepi8_mask(bytes);
+	if(high == 0)
+	{
+		_mm512_storeu_si512((void*) q, bytes);
+		*written= 64;
+		return 64;
+	}
+
+	lead= _mm512_cmpeq_epi8_mask(_mm512_and_si512(bytes, _mm512_set1_epi8((char) 0xfe)), _mm512_set1_epi8((char) 0xc2));
+	cont= _mm512_cmpeq_epi8_mask(_mm512_and_si512(bytes, _mm512_set1_epi8((char) 0xc0)), _mm512_set1_epi8((char) 0x80));
+	keep= ~cont;
+
+	/* a pair split by the window waits for the next one */
+	if(lead >> 63)
+	{
+		lead &= ~(1ull << 63);
+		high &= ~(1ull << 63);
+		keep &= ~(1ull << 63);
+		used= 63;
+	}
+
+	if((lead | cont) != high  ||  (lead << 1) != cont)
+		return 0;
+
+	/* the byte after each one, without reading past the window */
+	next= _mm512_maskz_loadu_epi8(~(1ull << 63), p + 1);
+	value= _mm512_or_si512(_mm512_and_si512(_mm512_slli_epi16(bytes, 6), _mm512_set1_epi8((char) 0xc0)),
+	                       _mm512_and_si512(next, _mm512_set1_epi8(0x3f)));
+	value= _mm512_mask_mov_epi8(bytes, lead, value);
+
+	_mm512_storeu_si512((void*) q, _mm512_maskz_compress_epi8(keep, value));
+	*written= unicoder_bitCount64(keep);
+	return used;
+}
+
+#endif
+
+
+#if defined(UNICODER_SIMD)
+
+/* stamps out the window loops around one tier's kernels, which read window bytes */
+#define  UNICODER_DEFINE_LATIN1(tier, target, window)                                  \
+static target int unicoder_##tier##_transcode_iso8859_1_utf8(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced)           \
+{                                                                                      \
+	size_t in= 0, out= 0;                                                              \
+	int bytesWritten, ret= 0;                                                          \
+                                                                                       \
+	while(in < srcLen)                                                                 \
+	{                                                                                  \
+		if(srcLen - in >= (window)  &&  dstCap - out >= 2 * (window))                  \
+		{                                                                              \
+			out += unicoder_##tier##_latin1ToUtf8(src + in, dst + out);                \
+			in += (window);                                                            \
+			continue;                                                                  \
+		}                                                                              \
+                                                                                       \
+		bytesWritten= unicoder_utf8_write(dst + out, dstCap - out, src[in]);           \
+		if(bytesWritten < 0)                                                           \
+		{                                                                              \
+			ret= bytesWritten;                                                         \
+			break;                                                                     \
+		}                                                                              \
+                                                                                       \
+		in++;                                                                          \
+		out += bytesWritten;                                                           \
+	}                                                                                  \
+                                                                                       \
+	*consumed= in;                                                                     \
+	*produced= out;                                                                    \
+	return ret;                                                                        \
+}                                                                                      \
+                                                                                       \
+static target int unicoder_##tier##_transcode_utf8_iso8859_1(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced)           \
+{                                                                                      \
+	size_t in= 0, out= 0, used, written, stop;                                         \
+	int bytesRead, bytesWritten, ret= 0;                                               \
+	unsigned int x;                                                                    \
+                                                                                       \
+	while(in < srcLen)                                                                 \
+	{                                                                                  \
+		if(srcLen - in >= (window)  &&  dstCap - out >= (window))                      \
+		{                                                                              \
+			used= unicoder_##tier##_utf8ToLatin1(src + in, dst + out, &written);       \
+			if(used > 0)                                                               \
+			{                                                                          \
+				in += used;                                                            \
+				out += written;                                                        \
+				continue;                                                              \
+			}                                                                          \
+		}                                                                              \
+                                                                                       \
+		/* the tail, or a window the kernel turned down, one code point at a time */   \
+		stop= in + (window);                                                           \
+		while(in < srcLen  &&  in < stop)                                              \
+		{                                                                              \
+			bytesRead= unicoder_utf8_read(src + in, srcLen - in, &x);                  \
+			if(bytesRead < 0)                                                          \
+			{                                                                          \
+				ret= bytesRead;                                                        \
+				break;                                                                 \
+			}                                                                          \
+                                                                                       \
+			bytesWritten= unicoder_iso8859_1_write(dst + out, dstCap - out, x);        \
+			if(bytesWritten < 0)                                                       \
+			{                                                                          \
+				ret= bytesWritten;                                                     \
+				break;                                                                 \
+			}                                                                          \
+                                                                                       \
+			in += bytesRead;                                                           \
+			out += bytesWritten;                                                       \
+		}                                                                              \
+                                                                                       \
+		if(ret != 0)                                                                   \
+			break;                                                                     \
+	}                                                                                  \
+                                                                                       \
+	*consumed= in;                                                                     \
+	*produced= out;                                                                    \
+	return ret;                                                                        \
+}
+
+#if defined(UNICODER_SSE)
+UNICODER_DEFINE_LATIN1(sse, UNICODER_TARGET_SSE, 16)
+#endif
+
+#if defined(UNICODER_AVX2)
+UNICODER_DEFINE_LATIN1(avx2, UNICODER_TARGET_AVX2, 32)
+#endif
+
+#if defined(UNICODER_AVX512)
+UNICODER_DEFINE_LATIN1(avx512, UNICODER_TARGET_AVX512, 64)
+#endif
+
+#endif
+
+
+
+
+
+
+/*
+Byte order swapping.
+
+utf-16 and utf-32 going to the other byte order keep every unit where it is and only reverse its bytes,
+which one pshufb per vector does. The transcoders check the units while they are in registers: utf-16
+needs every high surrogate followed by a low one and no low one on its own, utf-32 needs nothing above
+0x10ffff and no surrogates. A window that fails goes to the scalar steps, which find the exact offset.
+Going to the same byte order is the same check with the window stored as it was loaded.
+*/
+
+#if defined(UNICODER_SIMD)
+
+#define  UNICODER_SWAP16_SHUFFLE  1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
+#define  UNICODER_SWAP32_SHUFFLE  3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12
+
+#if defined(UNICODER_SSE)
+
+/* copies 8 utf-16 units from p to q, their bytes swapped if swap is set, if they pair up */
+/* returns bytes consumed or 0 to leave the window to the scalar steps */
+UNICODER_INLINE UNICODER_TARGET_SSE size_t unicoder_sse_swapUtf16(const unsigned char* p, unsigned char* q, unsigned int endianness, int swap)
+{
+	__m128i raw, swapped, units, tag;
+	unsigned int highMask, lowMask;
+
+	raw= _mm_loadu_si128((const __m128i*) p);
+	swapped= _mm_shuffle_epi8(raw, _mm_setr_epi8(UNICODER_SWAP16_SHUFFLE));
+	units= (endianness == UNICODER_LES) ? raw : swapped;
+
+	tag= _mm_and_si128(units, _mm_set1_epi16((short) 0xfc00));
+	highMask= _mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(tag, _mm_set1_epi16((short) 0xd800)), _mm_setzero_si128()));
+	lowMask= _mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(tag, _mm_set1_epi16((short) 0xdc00)), _mm_setzero_si128()));
+
+	if(((highMask << 1) & 0xff) != lowMask)
+		return 0;
+
+	_mm_storeu_si128((__m128i*) q, swap ? swapped : raw);
+
+	/* a pair split by the end of the window is left for the next one */
+	return (highMask & 0x80) ? 14 : 16;
+}
+
+
+/* copies 4 utf-32 units from p to q, swapped if swap is set, if they are all code points */
+/* returns bytes consumed or 0 */
+UNICODER_INLINE UNICODER_TARGET_SSE size_t unicoder_sse_swapUtf32(const unsigned char* p, unsigned char* q, unsigned int endianness, int swap)
+{
+	__m128i raw, swapped, units, inRange, surrogate;
+	const __m128i limit= _mm_set1_epi32(0x10ffff);
+
+	raw= _mm_loadu_si128((const __m128i*) p);
+	swapped= _mm_shuffle_epi8(raw, _mm_setr_epi8(UNICODER_SWAP32_SHUFFLE));
+	units= (endianness == UNICODER_LES) ? raw : swapped;
+
+	inRange= _mm_cmpeq_epi32(_mm_max_epu32(units, limit), limit);
+	surrogate= _mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32((int) 0xfffff800)), _mm_set1_epi32(0xd800));
+
+	if(_mm_movemask_epi8(_mm_andnot_si128(surrogate, inRange)) != 0xffff)
+		return 0;
+
+	_mm_storeu_si128((__m128i*) q, swap ? swapped : raw);
+	return 16;
+}
+
+
+/* swaps the bytes of the unitSize byte units in len bytes a vector at a time, returns bytes done */
+static UNICODER_TARGET_SSE size_t unicoder_sse_swapBytes(const unsigned char* src, unsigned char* dst, size_t len, unsigned int unitSize)
+{
+	const __m128i shuffle= (unitSize == 2)
+	                       ? _mm_setr_epi8(UNICODER_SWAP16_SHUFFLE)
+	                       : _mm_setr_epi8(UNICODER_SWAP32_SHUFFLE);
+	size_t i;
+
+	for(i= 0; i + 16 <= len; i += 16)
+		_mm_storeu_si128((__m128i*) (dst + i), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (src + i)), shuffle));
+
+	return i;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX2)
+
+/* copies 16 utf-16 units from p to q, their bytes swapped if swap is set, if they pair up */
+/* returns bytes consumed or 0 to leave the window to the scalar steps */
+UNICODER_INLINE UNICODER_TARGET_AVX2 size_t unicoder_avx2_swapUtf16(const unsigned char* p, unsigned char* q, unsigned int endianness, int swap)
+{
+	__m256i raw, swapped, units, tag;
+	unsigned int highMask, lowMask;
+
+	raw= _mm256_loadu_si256((const __m256i*) p);
+	swapped= _mm256_shuffle_epi8(raw, _mm256_setr_epi8(UNICODER_SWAP16_SHUFFLE, UNICODER_SWAP16_SHUFFLE));
+	units= (endianness == UNICODER_LES) ? raw : swapped;
+
+	/* two mask bits per unit */
+	tag= _mm256_and_si256(units, _mm256_set1_epi16((short) 0xfc00));
+	highMask= (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi16(tag, _mm256_set1_epi16((short) 0xd800)));
+	lowMask= (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi16(tag, _mm256_set1_epi16((short) 0xdc00)));
+
+	if((highMask << 2) != lowMask)
+		return 0;
+
+	_mm256_storeu_si256((__m256i*) q, swap ? swapped : raw);
+
+	/* a pair split by the end of the window is left for the next one */
+	return (highMask & 0x80000000) ? 30 : 32;
+}
+
+
+/* copies 8 utf-32 units from p to q, swapped if swap is set, if they are all code points */
+/* returns bytes consumed or 0 */
+UNICODER_INLINE UNICODER_TARGET_AVX2 size_t unicoder_avx2_swapUtf32(const unsigned char* p, unsigned char* q, unsigned int endianness, int swap)
+{
+	__m256i raw, swapped, units, inRange, surrogate;
+	const __m256i limit= _mm256_set1_epi32(0x10ffff);
+
+	raw= _mm256_loadu_si256((const __m256i*) p);
+	swapped= _mm256_shuffle_epi8(raw, _mm256_setr_epi8(UNICODER_SWAP32_SHUFFLE, UNICODER_SWAP32_SHUFFLE));
+	units= (endianness == UNICODER_LES) ? raw : swapped;
+
+	inRange= _mm256_cmpeq_epi32(_mm256_max_epu32(units, limit), limit);
+	surrogate= _mm256_cmpeq_epi32(_mm256_and_si256(units, _mm256_set1_epi32((int) 0xfffff800)), _mm256_set1_epi32(0xd800));
+
+	if(_mm256_movemask_epi8(_mm256_andnot_si256(surrogate, inRange)) != -1)
+		return 0;
+
+	_mm256_storeu_si256((__m256i*) q, swap ? swapped : raw);
+	return 32;
+}
+
+
+/* swaps the bytes of the unitSize byte units in len bytes a vector at a time, returns bytes done */
+static UNICODER_TARGET_AVX2 size_t unicoder_avx2_swapBytes(const unsigned char* src, unsigned char* dst, size_t len, unsigned int unitSize)
+{
+	const __m256i shuffle= (unitSize == 2)
+	                       ? _mm256_setr_epi8(UNICODER_SWAP16_SHUFFLE, UNICODER_SWAP16_SHUFFLE)
+	                       : _mm256_setr_epi8(UNICODER_SWAP32_SHUFFLE, UNICODER_SWAP32_SHUFFLE);
+	__m256i a, b;
+	size_t i;
+
+	for(i= 0; i + 64 <= len; i += 64)
+	{
+		a= _mm256_loadu_si256((const __m256i*) (src + i));
+		b= _mm256_loadu_si256((const __m256i*) (src + i + 32));
+		_mm256_storeu_si256((__m256i*) (dst + i), _mm256_shuffle_epi8(a, shuffle));
+		_mm256_storeu_si256((__m256i*) (dst + i + 32), _mm256_shuffle_epi8(b, shuffle));
+	}
+
+	return i;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX512)
+
+/* copies 32 utf-16 units from p to q, their bytes swapped if swap is set, if they pair up */
+/* returns bytes consumed or 0 to leave the window to the scalar steps */
+UNICODER_INLINE UNICODER_TARGET_AVX512 size_t unicoder_avx512_swapUtf16(const unsigned char* p, unsigned char* q, unsigned int endianness, int swap)
+{
+	__m512i raw, swapped, units, tag;
+	__mmask32 highMask, lowMask;
+
+	raw= _mm512_loadu_si512((const void*) p);
+	swapped= _mm512_shuffle_epi8(raw, _mm512_broadcast_i32x4(_mm_setr_epi8(UNICODER_SWAP16_SHUFFLE)));
+	units= (endianness == UNICODER_LES) ? raw : swapped;
+
+	tag= _mm512_and_si512(units, _mm512_set1_epi16((short) 0xfc00));
+	highMask= _mm512_cmpeq_epi16_mask(tag, _mm512_set1_epi16((short) 0xd800));
+	lowMask= _mm512_cmpeq_epi16_mask(tag, _mm512_set1_epi16((short) 0xdc00));
+
+	if((__mmask32) (highMask << 1) != lowMask)
+		return 0;
+
+	_mm512_storeu_si512((void*) q, swap ? swapped : raw);
+
+	/* a pair split by the end of the window is left for the next one */
+	return (highMask & 0x80000000u) ? 62 : 64;
+}
+
+
+/* copies 16 utf-32 units from p to q, swapped if swap is set, if they are all code points */
+/* returns bytes consumed or 0 */
+UNICODER_INLINE UNICODER_TARGET_AVX512 size_t unicoder_avx512_swapUtf32(const unsigned char* p, unsigned char* q, unsigned int endianness, int swap)
+{
+	__m512i raw, swapped, units;
+	__mmask16 inRange, surrogate;
+
+	raw= _mm512_loadu_si512((const void*) p);
+	swapped= _mm512_shuffle_epi8(raw, _mm512_broadcast_i32x4(_mm_setr_epi8(UNICODER_SWAP32_SHUFFLE)));
+	units= (endianness == UNICODER_LES) ? raw : swapped;
+
+	inRange= _mm512_cmple_epu32_mask(units, _mm512_set1_epi32(0x10ffff));
+	surrogate= _mm512_cmpeq_epi32_mask(_mm512_and_si512(units, _mm512_set1_epi32((int) 0xfffff800)), _mm512_set1_epi32(0xd800));
+
+	if((inRange & ~surrogate) != 0xffff)
+		return 0;
+
+	_mm512_storeu_si512((void*) q, swap ? swapped : raw);
+	return 64;
+}
+
+
+/* swaps the bytes of the unitSize byte units in len bytes, the last partial vector under a mask, returns len */
+static UNICODER_TARGET_AVX512 size_t unicoder_avx512_swapBytes(const unsigned char* src, unsigned char* dst, size_t len, unsigned int unitSize)
+{
+	const __m512i shuffle= _mm512_broadcast_i32x4((unitSize == 2)
+	                                              ? _mm_setr_epi8(UNICODER_SWAP16_SHUFFLE)
+	                                              : _mm_setr_epi8(UNICODER_SWAP32_SHUFFLE));
+	__mmask64 tail;
+	size_t i;
+
+	for(i= 0; i + 64 <= len; i += 64)
+		_mm512_storeu_si512((void*) (dst + i), _mm512_shuffle_epi8(_mm512_loadu_si512((const void*) (src + i)), shuffle));
+
+	if(i < len)
+	{
+		tail= ((__mmask64) 1 << (len - i)) - 1;
+		_mm512_mask_storeu_epi8(dst + i, tail, _mm512_shuffle_epi8(_mm512_maskz_loadu_epi8(tail, src + i), shuffle));
+	}
+
+	return len;
+}
+
+#endif
+
+
+/* stamps out same width, either byte order for one tier; endianness is that of the source, */
+/* dstEndianness that of the output and window what the kernels read and write */
+#define  UNICODER_DEFINE_SWAPPED(tier, target, window)                                 \
+UNICODER_INLINE target int unicoder_##tier##_transcodeSwapped(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced,           \
+                                         unsigned int width, unsigned int endianness,  \
+                                         unsigned int dstEndianness)                   \
+{                                                                                      \
+	size_t in= 0, out= 0, used, stop;                                                  \
+	int bytesRead, bytesWritten, ret= 0;                                               \
+	unsigned int x;                                                                    \
+	int swap= (endianness != dstEndianness);                                           \
+                                                                                       \
+	while(in < srcLen)                                                                 \
+	{                                                                                  \
+		if(srcLen - in >= (window)  &&  dstCap - out >= (window))                      \
+		{                                                                              \
+			if(width == 2)                                                             \
+				used= unicoder_##tier##_swapUtf16(src + in, dst + out, endianness, swap); \
+			else                                                                       \
+				used= unicoder_##tier##_swapUtf32(src + in, dst + out, endianness, swap); \
+                                                                                       \
+			if(used > 0)                                                               \
+			{                                                                          \
+				in += used;                                                            \
+				out += used;                                                           \
+				continue;                                                              \
+			}                                                                          \
+		}                                                                              \
+                                                                                       \
+		/* the tail, or a window the kernel turned down, one code point at a time */   \
+		stop= in + (window);                                                           \
+		while(in < srcLen  &&  in < stop)                                              \
+		{                                                                              \
+			if(width == 2)                                                             \
+				bytesRead= unicoder_utf16_read(src + in, srcLen - in, &x, endianness); \
+			else                                                                       \
+				bytesRead= unicoder_utf32_read(src + in, srcLen - in, &x, endianness); \
+                                                                                       \
+			if(bytesRead < 0)                                                          \
+			{                                                                          \
+				ret= bytesRead;                                                        \
+				break;                                                                 \
+			}                                                                          \
+                                                                                       \
+			if(width == 2)                                                             \
+				bytesWritten= unicoder_utf16_write(dst + out, dstCap - out, x, dstEndianness); \
+			else                                                                       \
+				bytesWritten= unicoder_utf32_write(dst + out, dstCap - out, x, dstEndianness); \
+                                                                                       \
+			if(bytesWritten < 0)                                                       \
+			{                                                                          \
+				ret= bytesWritten;                                                     \
+				break;                                                                 \
+			}                                                                          \
+                                                                                       \
+			in += bytesRead;                                                           \
+			out += bytesWritten;                                                       \
+		}                                                                              \
+                                                                                       \
+		if(ret != 0)                                                                   \
+			break;                                                                     \
+	}                                                                                  \
+                                                                                       \
+	*consumed= in;                                                                     \
+	*produced= out;                                                                    \
+	return ret;                                                                        \
+}                                                                                      \
+                                                                                       \
+static target int unicoder_##tier##_transcode_utf16be_utf16le(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced)           \
+{                                                                                      \
+	return unicoder_##tier##_transcodeSwapped(src, srcLen, dst, dstCap, consumed, produced, 2, UNICODER_BES, UNICODER_LES); \
+}                                                                                      \
+                                                                                       \
+static target int unicoder_##tier##_transcode_utf16le_utf16be(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced)           \
+{                                                                                      \
+	return unicoder_##tier##_transcodeSwapped(src, srcLen, dst, dstCap, consumed, produced, 2, UNICODER_LES, UNICODER_BES); \
+}                                                                                      \
+                                                                                       \
+static target int unicoder_##tier##_transcode_utf32be_utf32le(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced)           \
+{                                                                                      \
+	return unicoder_##tier##_transcodeSwapped(src, srcLen, dst, dstCap, consumed, produced, 4, UNICODER_BES, UNICODER_LES); \
+}                                                                                      \
+                                                                                       \
+static target int unicoder_##tier##_transcode_utf32le_utf32be(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced)           \
+{                                                                                      \
+	return unicoder_##tier##_transcodeSwapped(src, srcLen, dst, dstCap, consumed, produced, 4, UNICODER_LES, UNICODER_BES); \
+} \
+                                                                                       \
+static target int unicoder_##tier##_transcode_utf16be_utf16be(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced)           \
+{                                                                                      \
+	return unicoder_##tier##_transcodeSwapped(src, srcLen, dst, dstCap, consumed, produced, 2, UNICODER_BES, UNICODER_BES); \
+} \
+                                                                                       \
+static target int unicoder_##tier##_transcode_utf16le_utf16le(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced)           \
+{                                                                                      \
+	return unicoder_##tier##_transcodeSwapped(src, srcLen, dst, dstCap, consumed, produced, 2, UNICODER_LES, UNICODER_LES); \
+} \
+                                                                                       \
+static target int unicoder_##tier##_transcode_utf32be_utf32be(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced)           \
+{                                                                                      \
+	return unicoder_##tier##_transcodeSwapped(src, srcLen, dst, dstCap, consumed, produced, 4, UNICODER_BES, UNICODER_BES); \
+} \
+                                                                                       \
+static target int unicoder_##tier##_transcode_utf32le_utf32le(const unsigned char* src, size_t srcLen, \
+                                         unsigned char* dst, size_t dstCap,            \
+                                         size_t* consumed, size_t* produced)           \
+{                                                                                      \
+	return unicoder_##tier##_transcodeSwapped(src, srcLen, dst, dstCap, consumed, produced, 4, UNICODER_LES, UNICODER_LES); \
+}
+
+#if defined(UNICODER_SSE)
+UNICODER_DEFINE_SWAPPED(sse, UNICODER_TARGET_SSE, 16)
+#endif
+
+#if defined(UNICODER_AVX2)
+UNICODER_DEFINE_SWAPPED(avx2, UNICODER_TARGET_AVX2, 32)
+#endif
+
+#if defined(UNICODER_AVX512)
+UNICODER_DEFINE_SWAPPED(avx512, UNICODER_TARGET_AVX512, 64)
+#endif
+
+#endif
+
+
+/* swaps the bytes of every unitSize (2 or 4) byte unit in len bytes from src to dst */
+/* dst may be src itself to swap in place, but must not overlap it otherwise; the contents are not checked */
+/* returns 0 or error code */
+int unicoder_swapByteOrder(const unsigned char* src, unsigned char* dst, size_t len, unsigned int unitSize)
+{
+	size_t i= 0;
+	unsigned char t;
+
+	if((src == NULL  ||  dst == NULL)  &&  len > 0)
+		return UNICODER_NULL_POINTER;
+
+	if((unitSize != 2  &&  unitSize != 4)  ||  len % unitSize != 0)
+		return UNICODER_BAD_LENGTH;
+
+	if(unicoder_kernels()->swapBytes != NULL)
+		i= unicoder_kernels()->swapBytes(src, dst, len, unitSize);
+
+	if(unitSize == 2)
+	{
+		for(; i < len; i += 2)
+		{
+			t= src[i];
+			dst[i]= src[i + 1];
+			dst[i + 1]= t;
+		}
+	}
+
+	else
+	{
+		for(; i < len; i += 4)
+			unicoder_store32(dst + i, unicoder_load32(src + i, UNICODER_LES), UNICODER_BES);
+	}
+
+	return 0;
+}
+
+/* pairs with vector kernels go through the set bound for this cpu */
+#define  UNICODER_DEFINE_DISPATCHED(name, kernel)                                      \
+static int name(const unsigned char* src, size_t srcLen,                               \
+                unsigned char* dst, size_t dstCap,                                     \
+                size_t* consumed, size_t* produced)                                    \
+{                                                                                      \
+	return unicoder_kernels()->kernel(src, srcLen, dst, dstCap, consumed, produced);   \
+}
+
+UNICODER_DEFINE_DISPATCHED(unicoder_transcode_utf8_utf16be,     utf8ToUtf16be)
+UNICODER_DEFINE_DISPATCHED(unicoder_transcode_utf8_utf16le,     utf8ToUtf16le)
+UNICODER_DEFINE_DISPATCHED(unicoder_transcode_utf16be_utf8,     utf16beToUtf8)
+UNICODER_DEFINE_DISPATCHED(unicoder_transcode_utf16le_utf8,     utf16leToUtf8)
+UNICODER_DEFINE_DISPATCHED(unicoder_transcode_utf16be_utf16le,  utf16beToUtf16le)
+UNICODER_DEFINE_DISPATCHED(unicoder_transcode_utf16le_utf16be,  utf16leToUtf16be)
+UNICODER_DEFINE_DISPATCHED(unicoder_transcode_utf32be_utf32le,  utf32beToUtf32le)
+UNICODER_DEFINE_DISPATCHED(unicoder_transcode_utf32le_utf32be,  utf32leToUtf32be)
+UNICODER_DEFINE_DISPATCHED(unicoder_transcode_utf16be_utf16be,  utf16beToUtf16be)
+UNICODER_DEFINE_DISPATCHED(unicoder_transcode_utf16le_utf16le,  utf16leToUtf16le)
+UNICODER_DEFINE_DISPATCHED(unicoder_transcode_utf32be_utf32be,  utf32beToUtf32be)
+UNICODER_DEFINE_DISPATCHED(unicoder_transcode_utf32le_utf32le,  utf32leToUtf32le)
+UNICODER_DEFINE_DISPATCHED(unicoder_transcode_iso8859_1_utf8,    latin1ToUtf8)
+UNICODER_DEFINE_DISPATCHED(unicoder_transcode_utf8_iso8859_1,    utf8ToLatin1)
+
+
+/* indexed by [srcEncoding - 1][dstEncoding - 1] */
+static const unicoder_transcoder unicoder_transcoders[9][9]=
+{
+	{
+		unicoder_transcode_ascii_ascii,      unicoder_transcode_ascii_utf8,       unicoder_transcode_ascii_utf16be,
+		unicoder_transcode_ascii_utf16le,    unicoder_transcode_ascii_utf32be,    unicoder_transcode_ascii_utf32le,
+		unicoder_transcode_ascii_iso8859_1,  unicoder_transcode_ascii_iso8859_15, unicoder_transcode_ascii_cp1252
+	},
+	{
+		unicoder_transcode_utf8_ascii,      unicoder_transcode_utf8_utf8,       unicoder_transcode_utf8_utf16be,
+		unicoder_transcode_utf8_utf16le,    unicoder_transcode_utf8_utf32be,    unicoder_transcode_utf8_utf32le,
+		unicoder_transcode_utf8_iso8859_1,  unicoder_transcode_utf8_iso8859_15, unicoder_transcode_utf8_cp1252
+	},
+	{
+		unicoder_transcode_utf16be_ascii,      unicoder_transcode_utf16be_utf8,       unicoder_transcode_utf16be_utf16be,
+		unicoder_transcode_utf16be_utf16le,    unicoder_transcode_utf16be_utf32be,    unicoder_transcode_utf16be_utf32le,
+		unicoder_transcode_utf16be_iso8859_1,  unicoder_transcode_utf16be_iso8859_15, unicoder_transcode_utf16be_cp1252
+	},
+	{
+		unicoder_transcode_utf16le_ascii,      unicoder_transcode_utf16le_utf8,       unicoder_transcode_utf16le_utf16be,
+		unicoder_transcode_utf16le_utf16le,    unicoder_transcode_utf16le_utf32be,    unicoder_transcode_utf16le_utf32le,
+		unicoder_transcode_utf16le_iso8859_1,  unicoder_transcode_utf16le_iso8859_15, unicoder_transcode_utf16le_cp1252
+	},
+	{
+		unicoder_transcode_utf32be_ascii,      unicoder_transcode_utf32be_utf8,       unicoder_transcode_utf32be_utf16be,
+		unicoder_transcode_utf32be_utf16le,    unicoder_transcode_utf32be_utf32be,    unicoder_transcode_utf32be_utf32le,
+		unicoder_transcode_utf32be_iso8859_1,  unicoder_transcode_utf32be_iso8859_15, unicoder_transcode_utf32be_cp1252
+	},
+	{
+		unicoder_transcode_utf32le_ascii,      unicoder_transcode_utf32le_utf8,       unicoder_transcode_utf32le_utf16be,
+		unicoder_transcode_utf32le_utf16le,    unicoder_transcode_utf32le_utf32be,    unicoder_transcode_utf32le_utf32le,
+		unicoder_transcode_utf32le_iso8859_1,  unicoder_transcode_utf32le_iso8859_15, unicoder_transcode_utf32le_cp1252
+	},
+	{
+		unicoder_transcode_iso8859_1_ascii,      unicoder_transcode_iso8859_1_utf8,       unicoder_transcode_iso8859_1_utf16be,
+		unicoder_transcode_iso8859_1_utf16le,    unicoder_transcode_iso8859_1_utf32be,    unicoder_transcode_iso8859_1_utf32le,
+		unicoder_transcode_iso8859_1_iso8859_1,  unicoder_transcode_iso8859_1_iso8859_15, unicoder_transcode_iso8859_1_cp1252
+	},
+	{
+		unicoder_transcode_iso8859_15_ascii,      unicoder_transcode_iso8859_15_utf8,       unicoder_transcode_iso8859_15_utf16be,
+		unicoder_transcode_iso8859_15_utf16le,    unicoder_transcode_iso8859_15_utf32be,    unicoder_transcode_iso8859_15_utf32le,
+		unicoder_transcode_iso8859_15_iso8859_1,  unicoder_transcode_iso8859_15_iso8859_15, unicoder_transcode_iso8859_15_cp1252
+	},
+	{
+		unicoder_transcode_cp1252_ascii,      unicoder_transcode_cp1252_utf8,       unicoder_transcode_cp1252_utf16be,
+		unicoder_transcode_cp1252_utf16le,    unicoder_transcode_cp1252_utf32be,    unicoder_transcode_cp1252_utf32le,
+		unicoder_transcode_cp1252_iso8859_1,  unicoder_transcode_cp1252_iso8859_15, unicoder_transcode_cp1252_cp1252
+	}
+};
+
+
+/* converts srcLen bytes of src from srcEncoding into dst (at most dstCap bytes) using dstEncoding */
+/* consumed and produced (either may be NULL) receive how many bytes were read and written, even on error */
+/* on error consumed points at the offending sequence; returns 0 on success or error code */
+int unicoder_transcode(const unsigned char* src, size_t srcLen, unsigned int srcEncoding,
+                       unsigned char* dst, size_t dstCap, unsigned int dstEncoding,
+                       size_t* consumed, size_t* produced)
+{
+	size_t in= 0, out= 0;
+	int ret;
+	UNICODER_TIMER_DECLARE(started)
+
+	if(consumed != NULL)
+		*consumed= 0;
+
+	if(produced != NULL)
+		*produced= 0;
+
+	if((src == NULL  &&  srcLen > 0)  ||  (dst == NULL  &&  dstCap > 0))
+		return UNICODER_STATS_ERROR(UNICODER_NULL_POINTER);
+
+	if(srcEncoding < UNICODER_ASCII  ||  UNICODER_CP1252 < srcEncoding)
+		return UNICODER_STATS_ERROR(UNICODER_ENCODING_UNRECOGNIZED);
+
+	if(dstEncoding < UNICODER_ASCII  ||  UNICODER_CP1252 < dstEncoding)
+		return UNICODER_STATS_ERROR(UNICODER_ENCODING_UNRECOGNIZED);
+
+	if(srcLen == 0)
+		return 0;
+
+	UNICODER_TIMER_START(started);
+	ret= unicoder_transcoders[srcEncoding - 1][dstEncoding - 1](src, srcLen, dst, dstCap, &in, &out);
+	UNICODER_TIMER_STOP(started, UNICODER_TIMER_TRANSCODE);
+
+	if(consumed != NULL)
+		*consumed= in;
+
+	if(produced != NULL)
+		*produced= out;
+
+	return UNICODER_STATS_TRANSCODE(src, in, srcEncoding, out, dstEncoding, ret);
+}
+
+
+
+
+
+
+/*
+Buffered stream reading.
+
+The reader pulls the file in through one large buffer and never seeks, so it works on pipes, sockets
+and stdin as well as regular files. A code point split across two refills is moved to the front of
+the buffer and completed by the next one.
+
+Under UNICODER_POSIX_READ a refill is a single read of the file's descriptor, which hands back
+whatever a pipe or terminal has instead of waiting, as fread does, for the whole buffer or the end
+of the file; the reader only asks for more when nothing buffered can be used, so a line typed into
+a pipe comes out as soon as it arrives. Reading the descriptor goes around stdio, so it is only used
+when stdio holds nothing for the stream: on a file that seeks, the reader compares ftello with the
+descriptor's offset and goes through fread if they differ. A pipe cannot be asked, so one that was
+read through stdio before it was handed to the reader loses what stdio had buffered. Streams without
+a descriptor, and every stream when UNICODER_NO_POSIX_READ is defined, are refilled with fread.
+
+Closing the reader puts a file that seeks back at the first byte the reader did not hand out, so the
+caller can carry on from there through stdio.
+*/
+
+#define  UNICODER_READER_BUFFER  65536
+
+struct unicoder_reader
+{
+	FILE* f;
+	unsigned int encoding;
+	unsigned char* buf;
+	size_t cap; /* bytes buf has room for, more once a record does not fit */
+	size_t start, end; /* unread bytes are buf[start..end) */
+	int eof;
+	int fd; /* descriptor refills read, -1 to go through fread */
+};
+
+
+/* keeps what is left unread and tops the buffer up, returns 0 or error code */
+static int unicoder_reader_refill(unicoder_reader* r)
+{
+	size_t want, got;
+#if defined(UNICODER_POSIX_READ)
+	ssize_t bytesRead;
+#endif
+	UNICODER_TIMER_DECLARE(started)
+
+	if(r->eof)
+		return 0;
+
+	if(r->start > 0)
+	{
+		memmove(r->buf, r->buf + r->start, r->end - r->start);
+		r->end -= r->start;
+		r->start= 0;
+	}
+
+	want= r->cap - r->end;
+	if(want == 0)
+		return 0;
+
+	UNICODER_TIMER_START(started);
+
+#if defined(UNICODER_POSIX_READ)
+	/* one read, of whatever is there already or the first bytes to arrive */
+	if(r->fd >= 0)
+	{
+		do
+			bytesRead= read(r->fd, r->buf + r->end, want);
+		while(bytesRead < 0  &&  errno == EINTR);
+		UNICODER_TIMER_STOP(started, UNICODER_TIMER_READER_IO);
+
+		if(bytesRead < 0)
+			return UNICODER_FILE_IO_ERROR;
+
+		if(bytesRead == 0)
+			r->eof= 1;
+
+		r->end += (size_t) bytesRead;
+		return 0;
+	}
+#endif
+
+	got= fread(r->buf + r->end, 1, want, r->f);
+	UNICODER_TIMER_STOP(started, UNICODER_TIMER_READER_IO);
+	r->end += got;
+
+	/* fread only comes up short at the end of the file or on an error */
+	if(got < want)
+	{
+		if(ferror(r->f))
+			return UNICODER_FILE_IO_ERROR;
+		r->eof= 1;
+	}
+
+	return 0;
+}
+
+
+/* read step picked at run time, for callers that cannot have a loop per encoding */
+static int unicoder_readStep(const unsigned char* p, size_t avail, unsigned int* cp, unsigned int encoding)
+{
+	switch(encoding)
+	{
+		case UNICODER_ASCII:      return unicoder_ascii_read(p, avail, cp);
+		case UNICODER_UTF8:       return unicoder_utf8_read(p, avail, cp);
+		case UNICODER_UTF16BE:    return unicoder_utf16be_read(p, avail, cp);
+		case UNICODER_UTF16LE:    return unicoder_utf16le_read(p, avail, cp);
+		case UNICODER_UTF32BE:    return unicoder_utf32be_read(p, avail, cp);
+		case UNICODER_UTF32LE:    return unicoder_utf32le_read(p, avail, cp);
+		case UNICODER_ISO8859_1:  return unicoder_iso8859_1_read(p, avail, cp);
+		case UNICODER_ISO8859_15: return unicoder_iso8859_15_read(p, avail, cp);
+		case UNICODER_CP1252:     return unicoder_cp1252_read(p, avail, cp);
+	}
+
+	return UNICODER_ENCODING_UNRECOGNIZED;
+}
+
+
+/* encoding the byte order mark at the start of len bytes at p stands for, 0 if there is none */
+/* bomLen (may be NULL) receives its length */
+static unsigned int unicoder_bomEncoding(const unsigned char* p, size_t len, size_t* bomLen)
+{
+	unsigned char head[4]= { 0, 0, 0, 0 };
+	unsigned int encoding;
+	size_t markLen= 0;
+
+	memcpy(head, p, (len < 4) ? len : 4);
+	encoding= (unsigned int) unicoder_decodeBom(head);
+
+	/* the zeros padding a short head are not the rest of FF FE 00 00, which is a utf-16le mark */
+	/* on its own, the one an empty utf-16le document starts with */
+	if(encoding == UNICODER_UTF32LE  &&  len < 4)
+		encoding= UNICODER_UTF16LE;
+
+	switch(encoding)
+	{
+		case UNICODER_UTF8:    markLen= 3; break;
+		case UNICODER_UTF16BE:
+		case UNICODER_UTF16LE: markLen= 2; break;
+		case UNICODER_UTF32BE:
+		case UNICODER_UTF32LE: markLen= 4; break;
+		default:               encoding= 0; break;
+	}
+
+	if(bomLen != NULL)
+		*bomLen= markLen;
+
+	return encoding;
+}
+
+
+/* whether the len bytes at p could still turn into a longer byte order mark, nothing at all included */
+static int unicoder_bomPrefix(const unsigned char* p, size_t len)
+{
+	static const unsigned char marks[4][4]= { { 0xef, 0xbb, 0xbf }, { 0xfe, 0xff }, { 0xff, 0xfe, 0x00, 0x00 }, { 0x00, 0x00, 0xfe, 0xff } };
+	static const size_t markLens[4]= { 3, 2, 4, 4 };
+	unsigned int i;
+
+	for(i= 0; i < 4; i++)
+	{
+		if(len < markLens[i]  &&  memcmp(p, marks[i], len) == 0)
+			return 1;
+	}
+
+	return 0;
+}
+
+
+/* write step picked at run time, as unicoder_readStep is for reading */
+static int unicoder_writeStep(unsigned char* p, size_t avail, unsigned int x, unsigned int encoding)
+{
+	switch(encoding)
+	{
+		case UNICODER_ASCII:      return unicoder_ascii_write(p, avail, x);
+		case UNICODER_UTF8:       return unicoder_utf8_write(p, avail, x);
+		case UNICODER_UTF16BE:    return unicoder_utf16be_write(p, avail, x);
+		case UNICODER_UTF16LE:    return unicoder_utf16le_write(p, avail, x);
+		case UNICODER_UTF32BE:    return unicoder_utf32be_write(p, avail, x);
+		case UNICODER_UTF32LE:    return unicoder_utf32le_write(p, avail, x);
+		case UNICODER_ISO8859_1:  return unicoder_iso8859_1_write(p, avail, x);
+		case UNICODER_ISO8859_15: return unicoder_iso8859_15_write(p, avail, x);
+		case UNICODER_CP1252:     return unicoder_cp1252_write(p, avail, x);
+	}
+
+	return UNICODER_ENCODING_UNRECOGNIZED;
+}
+
+
+/* completes the code point cut off at the end of the last chunk (pendingLen bytes in pending) with the */
+/* first bytes of src and converts it to dst; stores the bytes of src it took in taken and written in written */
+/* returns 0 or error code, pendingLen is left nonzero if src ran out before the code point was whole */
+static int unicoder_completePending(unsigned char* pending, size_t* pendingLen,
+                                    const unsigned char* src, size_t srcLen, unsigned int srcEncoding,
+                                    unsigned char* dst, size_t dstCap, unsigned int dstEncoding,
+                                    size_t* taken, size_t* written)
+{
+	unsigned char joined[8], encoded[4];
+	size_t extra;
+	unsigned int x;
+	int bytesRead, bytesWritten;
+
+	*taken= 0;
+	*written= 0;
+
+	extra= (srcLen < 4) ? srcLen : 4;
+	memcpy(joined, pending, *pendingLen);
+	memcpy(joined + *pendingLen, src, extra);
+
+	bytesRead= unicoder_readStep(joined, *pendingLen + extra, &x, srcEncoding);
+
+	/* still not whole, keep collecting */
+	if(bytesRead == UNICODER_INCOMPLETE_SEQUENCE  &&  extra == srcLen)
+	{
+		memcpy(pending + *pendingLen, src, extra);
+		*pendingLen += extra;
+		*taken= extra;
+		return 0;
+	}
+
+	if(bytesRead < 0)
+		return bytesRead;
+
+	bytesWritten= unicoder_writeCodePoint(encoded, x, dstEncoding);
+	if(bytesWritten < 0)
+		return bytesWritten;
+
+	if((size_t) bytesWritten > dstCap)
+		return UNICODER_OUTPUT_BUFFER_FULL;
+
+	memcpy(dst, encoded, bytesWritten);
+	*written= bytesWritten;
+	*taken= bytesRead - *pendingLen;
+	*pendingLen= 0;
+	return 0;
+}
+
+
+/* opens a reader on f, encoding 0 means take it from the byte order mark, returns NULL on failure */
+/* a byte order mark at the start is skipped, the caller still owns f but must not read it while the */
+/* reader is open; a pipe must not have been read through stdio beforehand either */
+unicoder_reader* unicoder_reader_open(FILE* f, unsigned int encoding)
+{
+	unicoder_reader* r;
+	unsigned int bom;
+	int bytesRead;
+#if defined(UNICODER_POSIX_READ)
+	off_t at;
+#endif
+
+	if(f == NULL)
+		return NULL;
+
+	if(encoding > UNICODER_CP1252)
+		return NULL;
+
+	r= (unicoder_reader*) malloc(sizeof(unicoder_reader));
+	if(r == NULL)
+		return NULL;
+
+	r->buf= (unsigned char*) malloc(UNICODER_READER_BUFFER);
+	if(r->buf == NULL)
+	{
+		free(r);
+		return NULL;
+	}
+
+	r->f= f;
+	r->cap= UNICODER_READER_BUFFER;
+	r->start= 0;
+	r->end= 0;
+	r->eof= 0;
+	r->fd= -1;
+
+#if defined(UNICODER_POSIX_READ)
+	/* the descriptor only while stdio has nothing buffered ahead of it, which a pipe cannot tell */
+	r->fd= fileno(f);
+	if(r->fd >= 0)
+	{
+		at= ftello(f);
+		if(at >= 0  &&  lseek(r->fd, 0, SEEK_CUR) != at)
+			r->fd= -1;
+	}
+#endif
+
+	/* no more of the file than the byte order mark needs, a pipe may not have sent the rest yet */
+	do
+	{
+		if(unicoder_reader_refill(r) != 0)
+		{
+			unicoder_reader_close(r);
+			return NULL;
+		}
+	}
+	while(!r->eof  &&  encoding == 0  &&  unicoder_bomPrefix(r->buf, r->end));
+
+	if(encoding == 0)
+	{
+		encoding= unicoder_bomEncoding(r->buf, r->end, NULL);
+		if(encoding == 0)
+			encoding= UNICODER_ASCII;
+	}
+
+	r->encoding= encoding;
+
+	/* the byte order mark is only a byte order mark at the very start */
+	for(;;)
+	{
+		bytesRead= (r->end > 0) ? unicoder_readStep(r->buf, r->end, &bom, r->encoding) : UNICODER_INCOMPLETE_SEQUENCE;
+		if(bytesRead != UNICODER_INCOMPLETE_SEQUENCE  ||  r->eof)
+			break;
+
+		if(unicoder_reader_refill(r) != 0)
+		{
+			unicoder_reader_close(r);
+			return NULL;
+		}
+	}
+
+	if(bytesRead > 0  &&  bom == 0x0000feff)
+		r->start= bytesRead;
+
+	return r;
+}
+
+
+/* encoding the reader decodes, either the one it was opened with or the one the byte order mark gave */
+unsigned int unicoder_reader_encoding(const unicoder_reader* r)
+{
+	if(r == NULL)
+		return 0;
+
+	return r->encoding;
+}
+
+
+/* reads the next code point into result, returns number of bytes read, UNICODER_EOF at the end or error code */
+int unicoder_reader_readCodePoint(unicoder_reader* r, unsigned int* result)
+{
+	int bytesRead, ret;
+
+	if(r == NULL  ||  result == NULL)
+		return UNICODER_NULL_POINTER;
+
+	/* back to the file only when the buffer is empty or ends inside the code point */
+	for(;;)
+	{
+		if(r->start == r->end)
+		{
+			if(r->eof)
+				return UNICODER_EOF;
+
+			ret= unicoder_reader_refill(r);
+			if(ret != 0)
+				return ret;
+			continue;
+		}
+
+		bytesRead= unicoder_readStep(r->buf + r->start, r->end - r->start, result, r->encoding);
+		if(bytesRead != UNICODER_INCOMPLETE_SEQUENCE  ||  r->eof)
+			break;
+
+		ret= unicoder_reader_refill(r);
+		if(ret != 0)
+			return ret;
+	}
+
+	if(bytesRead > 0)
+		r->start += bytesRead;
+
+	return UNICODER_STATS_READ(r->encoding, bytesRead);
+}
+
+
+/* converts as much of the stream as is buffered into dst (at most dstCap bytes) using dstEncoding */
+/* only goes back to the file when nothing buffered can be converted, so it does not stall on a quiet pipe */
+/* produced (may be NULL) receives the number of bytes written; returns 0, UNICODER_EOF at the end or error code */
+int unicoder_reader_read(unicoder_reader* r, unsigned char* dst, size_t dstCap, unsigned int dstEncoding, size_t* produced)
+{
+	size_t in, out;
+	int ret;
+
+	if(produced != NULL)
+		*produced= 0;
+
+	if(r == NULL  ||  dst == NULL)
+		return UNICODER_NULL_POINTER;
+
+	for(;;)
+	{
+		if(r->start == r->end)
+		{
+			ret= unicoder_reader_refill(r);
+			if(ret != 0)
+				return ret;
+
+			if(r->start == r->end)
+				return UNICODER_EOF;
+		}
+
+		ret= unicoder_transcode(r->buf + r->start, r->end - r->start, r->encoding,
+		                        dst, dstCap, dstEncoding, &in, &out);
+		r->start += in;
+
+		if(produced != NULL)
+			*produced= out;
+
+		/* a code point cut off by the end of the buffer, get the rest of it unless the file is done */
+		if(ret == UNICODER_INCOMPLETE_SEQUENCE  &&  out == 0  &&  !r->eof)
+		{
+			ret= unicoder_reader_refill(r);
+			if(ret != 0)
+				return ret;
+			continue;
+		}
+
+		if(ret == UNICODER_INCOMPLETE_SEQUENCE  &&  out > 0)
+			return 0;
+
+		if(ret == UNICODER_OUTPUT_BUFFER_FULL  &&  out > 0)
+			return 0;
+
+		return ret;
+	}
+}
+
+
+/* frees the reader, does not close the file it was reading; a file that seeks is left at the first */
+/* byte the reader did not hand out */
+void unicoder_reader_close(unicoder_reader* r)
+{
+#if defined(UNICODER_POSIX_READ)
+	off_t at;
+#endif
+
+	if(r == NULL)
+		return;
+
+	/* give back what was read ahead, which only a file that seeks can take */
+#if defined(UNICODER_POSIX_READ)
+	if(r->fd >= 0)
+	{
+		at= lseek(r->fd, 0, SEEK_CUR);
+		if(at >= 0)
+			fseeko(r->f, at - (off_t) (r->end - r->start), SEEK_SET);
+	}
+	else
+#endif
+	if(r->end > r->start  &&  ftell(r->f) >= 0)
+		fseek(r->f, -(long) (r->end - r->start), SEEK_CUR);
+
+	free(r->buf);
+	free(r);
+}
+
+
+
+
+
+
+/*
+Buffered stream writing.
+
+The writer encodes into one large buffer and hands it to fwrite whole, instead of going through
+stdio a byte at a time.
+*/
+
+#define  UNICODER_WRITER_BUFFER  65536
+
+struct unicoder_writer
+{
+	FILE* f;
+	unsigned int encoding;
+	unsigned char* buf;
+	size_t used;
+	unsigned char pending[4]; /* start of a code point the last span cut off */
+	size_t pendingLen;
+	unsigned int pendingEncoding;
+};
+
+
+/* opens a writer on f that encodes to encoding, puts a byte order mark first if bom is nonzero */
+/* returns NULL on failure, the caller still owns f */
+unicoder_writer* unicoder_writer_open(FILE* f, unsigned int encoding, int bom)
+{
+	unicoder_writer* w;
+	int numBytes;
+
+	if(f == NULL)
+		return NULL;
+
+	if(encoding < UNICODER_ASCII  ||  UNICODER_CP1252 < encoding)
+		return NULL;
+
+	w= (unicoder_writer*) malloc(sizeof(unicoder_writer));
+	if(w == NULL)
+		return NULL;
+
+	w->buf= (unsigned char*) malloc(UNICODER_WRITER_BUFFER);
+	if(w->buf == NULL)
+	{
+		free(w);
+		return NULL;
+	}
+
+	w->f= f;
+	w->encoding= encoding;
+	w->used= 0;
+	w->pendingLen= 0;
+	w->pendingEncoding= 0;
+
+	if(bom)
+	{
+		numBytes= unicoder_encodeBom(w->buf, encoding);
+		if(numBytes > 0)
+			w->used= numBytes;
+	}
+
+	return w;
+}
+
+
+/* hands everything buffered to fwrite, returns 0 or error code */
+int unicoder_writer_flush(unicoder_writer* w)
+{
+	size_t used, written= 0;
+	UNICODER_TIMER_DECLARE(started)
+
+	if(w == NULL)
+		return UNICODER_NULL_POINTER;
+
+	used= w->used;
+	w->used= 0;
+
+	if(used > 0)
+	{
+		UNICODER_TIMER_START(started);
+		written= fwrite(w->buf, 1, used, w->f);
+		UNICODER_TIMER_STOP(started, UNICODER_TIMER_WRITER_IO);
+	}
+
+	if(written != used)
+		return UNICODER_FILE_IO_ERROR;
+
+	return 0;
+}
+
+
+/* writes single code point, returns number of bytes written or error code */
+int unicoder_writer_writeCodePoint(unicoder_writer* w, unsigned int x)
+{
+	int ret;
+
+	if(w == NULL)
+		return UNICODER_NULL_POINTER;
+
+	/* 4 bytes covers the longest code point in every encoding */
+	if(UNICODER_WRITER_BUFFER - w->used < 4)
+	{
+		ret= unicoder_writer_flush(w);
+		if(ret != 0)
+			return ret;
+	}
+
+	ret= unicoder_writeCodePoint(w->buf + w->used, x, w->encoding);
+	if(ret > 0)
+		w->used += ret;
+
+	return ret;
+}
+
+
+/* writes srcLen bytes of src in srcEncoding (utf-8, utf-32 or any other) */
+/* a code point cut off at the end of src is held back until the next call completes it */
+/* consumed (may be NULL) receives how many bytes of src were taken, on error it points at the offending sequence */
+/* returns 0 or error code */
+int unicoder_writer_write(unicoder_writer* w, const unsigned char* src, size_t srcLen, unsigned int srcEncoding, size_t* consumed)
+{
+	size_t done= 0, in, out;
+	int ret;
+
+	if(consumed != NULL)
+		*consumed= 0;
+
+	if(w == NULL)
+		return UNICODER_NULL_POINTER;
+
+	if(src == NULL  &&  srcLen > 0)
+		return UNICODER_NULL_POINTER;
+
+	if(w->pendingLen > 0  &&  srcLen > 0)
+	{
+		if(srcEncoding != w->pendingEncoding)
+			return UNICODER_INCOMPLETE_SEQUENCE;
+
+		if(UNICODER_WRITER_BUFFER - w->used < 4)
+		{
+			ret= unicoder_writer_flush(w);
+			if(ret != 0)
+				return ret;
+		}
+
+		ret= unicoder_completePending(w->pending, &w->pendingLen, src, srcLen, srcEncoding,
+		                              w->buf + w->used, UNICODER_WRITER_BUFFER - w->used, w->encoding, &done, &out);
+		w->used += out;
+		if(ret != 0)
+			return ret;
+	}
+
+	while(done < srcLen)
+	{
+		ret= unicoder_transcode(src + done, srcLen - done, srcEncoding,
+		                        w->buf + w->used, UNICODER_WRITER_BUFFER - w->used, w->encoding, &in, &out);
+		done += in;
+		w->used += out;
+
+		if(ret == 0)
+			break;
+
+		if(ret == UNICODER_INCOMPLETE_SEQUENCE)
+		{
+			memcpy(w->pending, src + done, srcLen - done);
+			w->pendingLen= srcLen - done;
+			w->pendingEncoding= srcEncoding;
+			done= srcLen;
+			break;
+		}
+
+		/* only a full buffer is worth another go, and only if flushing makes room */
+		if(ret != UNICODER_OUTPUT_BUFFER_FULL  ||  w->used == 0)
+		{
+			if(consumed != NULL)
+				*consumed= done;
+			return ret;
+		}
+
+		ret= unicoder_writer_flush(w);
+		if(ret != 0)
+		{
+			if(consumed != NULL)
+				*consumed= done;
+			return ret;
+		}
+	}
+
+	if(consumed != NULL)
+		*consumed= done;
+
+	return 0;
+}
+
+
+/* flushes and frees the writer, does not close the file */
+/* returns 0, UNICODER_INCOMPLETE_SEQUENCE if the last span ended inside a code point, or error code from the flush */
+int unicoder_writer_close(unicoder_writer* w)
+{
+	int ret;
+
+	if(w == NULL)
+		return UNICODER_NULL_POINTER;
+
+	ret= unicoder_writer_flush(w);
+	if(ret == 0  &&  w->pendingLen > 0)
+		ret= UNICODER_INCOMPLETE_SEQUENCE;
+
+	free(w->buf);
+	free(w);
+
+	return ret;
+}
+
+
+
+
+
+
+/*
+Whole file transcoding.
+
+The source is mapped, its encoding taken from the byte order mark, and the output sized for the
+worst case up front, so the bulk kernels run from one mapping straight into the other and the output
+is trimmed to what was produced at the end. The output's blocks are reserved with posix_fallocate
+before it is mapped: a sparse file would get its blocks only as the mapping is written, and a full
+disk or a quota then raises SIGBUS instead of failing a call. Where the space cannot be reserved, or
+there is no posix_fallocate, the output is built in memory and written out with write instead. Pipes,
+terminals and devices have no size to map or truncate; they, and every file where there is no mmap,
+are read in one go through stdio.
+*/
+
+/* most bytes srcLen bytes of srcEncoding can turn into in dstEncoding */
+static size_t unicoder_maxTranscodedLength(size_t srcLen, unsigned int srcEncoding, unsigned int dstEncoding)
+{
+	size_t unit, units, perUnit;
+
+	unit= (srcEncoding == UNICODER_UTF8  ||  unicoder_isSingleByte(srcEncoding)) ? 1 : ((srcEncoding <= UNICODER_UTF16LE) ? 2 : 4);
+	units= srcLen / unit + 1;
+
+	if(unicoder_isSingleByte(dstEncoding))
+		return units;
+
+	switch(dstEncoding)
+	{
+		case UNICODER_UTF8:
+			/* utf-8 copies over byte for byte, a code page byte or a utf-16 unit is at most 3 bytes, */
+			/* a utf-32 one at most 4 */
+			if(srcEncoding == UNICODER_ASCII  ||  srcEncoding == UNICODER_UTF8)
+				perUnit= 1;
+			else
+				perUnit= (unit == 4) ? 4 : 3;
+			break;
+
+		case UNICODER_UTF16BE:
+		case UNICODER_UTF16LE:
+			perUnit= (unit == 4) ? 4 : 2;
+			break;
+
+		default:
+			perUnit= 4;
+			break;
+	};
+
+	return units * perUnit;
+}
+
+
+static unsigned int unicoder_sourceEncoding(const unsigned char* src, size_t srcLen)
+{
+	unsigned int encoding= unicoder_bomEncoding(src, srcLen, NULL);
+
+	return (encoding != 0) ? encoding : UNICODER_ASCII;
+}
+
+
+/* transcodes a whole file's bytes from stats->srcEncoding; the source byte order mark is dropped and */
+/* written again in outEncoding only if that is a utf, the code pages have no U+FEFF */
+static int unicoder_transcodeContents(const unsigned char* src, size_t srcLen, unsigned char* dst, size_t dstCap,
+                                      unsigned int outEncoding, unicoder_fileStats* stats)
+{
+	size_t bomLen, bomOut= 0, in= 0, out= 0;
+	int ret;
+
+	unicoder_bomEncoding(src, srcLen, &bomLen);
+
+	/* dstCap leaves room for it, every encoding's mark is as long as the utf-32 one at most */
+	if(bomLen > 0  &&  !unicoder_isSingleByte(outEncoding))
+		bomOut= (size_t) unicoder_encodeBom(dst, outEncoding);
+
+	ret= unicoder_transcode(src + bomLen, srcLen - bomLen, stats->srcEncoding, dst + bomOut, dstCap - bomOut,
+	                        outEncoding, &in, &out);
+
+	stats->bytesRead= bomLen + in;
+	stats->bytesWritten= bomOut + out;
+	return ret;
+}
+
+
+#if defined(UNICODER_MMAP)
+
+/* writes the len bytes at p to fd, done receives how many made it; returns 0 or error code */
+static int unicoder_writeAll(int fd, const unsigned char* p, size_t len, size_t* done)
+{
+	ssize_t written;
+
+	*done= 0;
+	while(*done < len)
+	{
+		written= write(fd, p + *done, len - *done);
+		if(written < 0  &&  errno == EINTR)
+			continue;
+
+		if(written <= 0)
+			return UNICODER_FILE_IO_ERROR;
+
+		*done += (size_t) written;
+	}
+
+	return 0;
+}
+
+
+static int unicoder_transcodeMapped(int in, const struct stat* st, int out, unsigned int outEncoding, unicoder_fileStats* stats)
+{
+	unsigned char* src= NULL;
+	unsigned char* dst= NULL;
+	size_t srcLen, dstCap= 0;
+	int ret= 0, written;
+
+	srcLen= (size_t) st->st_size;
+	if(srcLen == 0)
+		return 0;
+
+	src= (unsigned char*) mmap(NULL, srcLen, PROT_READ, MAP_PRIVATE, in, 0);
+	if(src == (unsigned char*) MAP_FAILED)
+		return UNICODER_FILE_IO_ERROR;
+
+#if defined(POSIX_MADV_SEQUENTIAL)
+	posix_madvise(src, srcLen, POSIX_MADV_SEQUENTIAL);
+#endif
+
+	stats->srcEncoding= unicoder_sourceEncoding(src, srcLen);
+	dstCap= unicoder_maxTranscodedLength(srcLen, stats->srcEncoding, outEncoding);
+
+#if defined(UNICODER_FALLOCATE)
+	/* the mapping can only be written once the blocks behind it are there */
+	if(posix_fallocate(out, 0, (off_t) dstCap) == 0)
+	{
+		dst= (unsigned char*) mmap(NULL, dstCap, PROT_READ | PROT_WRITE, MAP_SHARED, out, 0);
+		if(dst == (unsigned char*) MAP_FAILED)
+			ret= UNICODER_FILE_IO_ERROR;
+		else
+		{
+			ret= unicoder_transcodeContents(src, srcLen, dst, dstCap, outEncoding, stats);
+			munmap(dst, dstCap);
+		}
+	}
+
+	else
+#endif
+	{
+		/* no room promised, so no mapping: write reports a full disk where a mapping would fault */
+		dst= (unsigned char*) malloc(dstCap);
+		if(dst == NULL)
+			ret= UNICODER_OUT_OF_MEMORY;
+		else
+		{
+			ret= unicoder_transcodeContents(src, srcLen, dst, dstCap, outEncoding, stats);
+
+			written= unicoder_writeAll(out, dst, stats->bytesWritten, &stats->bytesWritten);
+			if(written != 0  &&  ret == 0)
+				ret= written;
+			free(dst);
+		}
+	}
+
+	munmap(src, srcLen);
+
+	/* keep only what was written, an error leaves the output up to the offending sequence */
+	if(ftruncate(out, (off_t) stats->bytesWritten) != 0  &&  ret == 0)
+		ret= UNICODER_FILE_IO_ERROR;
+
+	return ret;
+}
+
+#endif
+
+
+static int unicoder_transcodeBuffered(FILE* in, FILE* out, unsigned int outEncoding, unicoder_fileStats* stats)
+{
+	unsigned char* src= NULL;
+	unsigned char* dst= NULL;
+	size_t srcLen= 0, srcCap= 1 << 20, got, dstCap;
+	int ret= 0;
+
+	src= (unsigned char*) malloc(srcCap);
+	if(src == NULL)
+		return UNICODER_OUT_OF_MEMORY;
+
+	/* the size of a non-regular file is not known up front, so grow until fread runs dry */
+	while((got= fread(src + srcLen, 1, srcCap - srcLen, in)) > 0)
+	{
+		srcLen += got;
+		if(srcLen == srcCap)
+		{
+			unsigned char* bigger= (unsigned char*) realloc(src, srcCap * 2);
+			if(bigger == NULL)
+			{
+				free(src);
+				return UNICODER_OUT_OF_MEMORY;
+			}
+			src= bigger;
+			srcCap *= 2;
+		}
+	}
+
+	if(ferror(in))
+		ret= UNICODER_FILE_IO_ERROR;
+
+	if(ret == 0  &&  srcLen > 0)
+	{
+		stats->srcEncoding= unicoder_sourceEncoding(src, srcLen);
+		dstCap= unicoder_maxTranscodedLength(srcLen, stats->srcEncoding, outEncoding);
+
+		dst= (unsigned char*) malloc(dstCap);
+		if(dst == NULL)
+			ret= UNICODER_OUT_OF_MEMORY;
+		else
+			ret= unicoder_transcodeContents(src, srcLen, dst, dstCap, outEncoding, stats);
+
+		if(dst != NULL  &&  fwrite(dst, 1, stats->bytesWritten, out) != stats->bytesWritten  &&  ret == 0)
+			ret= UNICODER_FILE_IO_ERROR;
+	}
+
+	free(dst);
+	free(src);
+	return ret;
+}
+
+
+/* transcodes in into a new file at outPath through stdio */
+static int unicoder_transcodeStream(FILE* in, const char* outPath, unsigned int outEncoding, unicoder_fileStats* stats)
+{
+	FILE* out;
+	int ret;
+
+	out= fopen(outPath, "wb");
+	if(out == NULL)
+		return UNICODER_FILE_IO_ERROR;
+
+	ret= unicoder_transcodeBuffered(in, out, outEncoding, stats);
+
+	if(fclose(out) != 0  &&  ret == 0)
+		ret= UNICODER_FILE_IO_ERROR;
+
+	return ret;
+}
+
+
+/* transcodes the file at inPath into a new file at outPath using outEncoding */
+/* the source encoding comes from the byte order mark, which is written again in outEncoding if that is a utf */
+/* and dropped for the code pages */
+/* stats (may be NULL) gets the source encoding and the bytes read and written, on error bytesRead is the offset */
+/* of the offending sequence and the output holds everything before it; outPath naming the same file as */
+/* inPath is refused with UNICODER_FILE_IO_ERROR; returns 0 on success or error code */
+int unicoder_transcodeFile(const char* inPath, const char* outPath, unsigned int outEncoding, unicoder_fileStats* stats)
+{
+	unicoder_fileStats local;
+	FILE* inFile;
+	int ret;
+	UNICODER_TIMER_DECLARE(started)
+#if defined(UNICODER_MMAP)
+	struct stat inStat, outStat;
+	int in, out, outExists;
+#endif
+
+	if(stats == NULL)
+		stats= &local;
+
+	stats->srcEncoding= UNICODER_ASCII;
+	stats->bytesRead= 0;
+	stats->bytesWritten= 0;
+
+	if(inPath == NULL  ||  outPath == NULL)
+		return UNICODER_NULL_POINTER;
+
+	if(outEncoding < UNICODER_ASCII  ||  UNICODER_CP1252 < outEncoding)
+		return UNICODER_ENCODING_UNRECOGNIZED;
+
+	UNICODER_TIMER_START(started);
+
+#if defined(UNICODER_MMAP)
+	in= open(inPath, O_RDONLY);
+	if(in < 0)
+		return UNICODER_FILE_IO_ERROR;
+
+	if(fstat(in, &inStat) != 0)
+	{
+		close(in);
+		return UNICODER_FILE_IO_ERROR;
+	}
+
+	/* truncating the output would empty the input before it is read */
+	outExists= (stat(outPath, &outStat) == 0);
+	if(outExists  &&  outStat.st_dev == inStat.st_dev  &&  outStat.st_ino == inStat.st_ino)
+	{
+		close(in);
+		return UNICODER_FILE_IO_ERROR;
+	}
+
+	if(S_ISREG(inStat.st_mode)  &&  (!outExists  ||  S_ISREG(outStat.st_mode)))
+	{
+		out= open(outPath, O_RDWR | O_CREAT | O_TRUNC, 0666);
+		if(out < 0)
+		{
+			close(in);
+			return UNICODER_FILE_IO_ERROR;
+		}
+
+		ret= unicoder_transcodeMapped(in, &inStat, out, outEncoding, stats);
+
+		if(close(out) != 0  &&  ret == 0)
+			ret= UNICODER_FILE_IO_ERROR;
+		close(in);
+	}
+
+	else
+	{
+		inFile= fdopen(in, "rb");
+		if(inFile == NULL)
+		{
+			close(in);
+			return UNICODER_FILE_IO_ERROR;
+		}
+
+		ret= unicoder_transcodeStream(inFile, outPath, outEncoding, stats);
+		fclose(inFile);
+	}
+#else
+	inFile= fopen(inPath, "rb");
+	if(inFile == NULL)
+		return UNICODER_FILE_IO_ERROR;
+
+	ret= unicoder_transcodeStream(inFile, outPath, outEncoding, stats);
+	fclose(inFile);
+#endif
+
+	UNICODER_TIMER_STOP(started, UNICODER_TIMER_TRANSCODE_FILE);
+	return ret;
+}
+
+
+
+
+
+
+/*
+Output length.
+
+Works out how many bytes a buffer turns into without writing any of them. utf-8 sources are validated
+with the vector kernels and then only their lead bytes need counting: every lead byte is one code point,
+which is 4 bytes of utf-32 and 2 of utf-16, plus 2 more for the F0..F4 leads that need a surrogate pair.
+Other sources go a code point at a time through the read steps.
+*/
+
+#if defined(UNICODER_AVX2)
+
+UNICODER_INLINE UNICODER_TARGET_AVX2 size_t unicoder_avx2_sumBytes(__m256i x)
+{
+	unsigned long long lanes[4];
+
+	_mm256_storeu_si256((__m256i*) lanes, _mm256_sad_epu8(x, _mm256_setzero_si256()));
+	return (size_t) (lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+}
+
+
+/* counts lead bytes and F0..FF bytes in the first multiple of 32 bytes, returns how many bytes it looked at */
+static UNICODER_TARGET_AVX2 size_t unicoder_avx2_utf8CountLeads(const unsigned char* p, size_t len, size_t* leads, size_t* longLeads)
+{
+	size_t i= 0, end;
+	__m256i in, leadCount, longCount;
+	const __m256i lastContinuation= _mm256_set1_epi8((char) 0xbf);
+	const __m256i firstLong= _mm256_set1_epi8((char) 0xf0);
+
+	while(i + 32 <= len)
+	{
+		/* the byte counters hold up to 255 before they have to be summed */
+		leadCount= _mm256_setzero_si256();
+		longCount= _mm256_setzero_si256();
+		end= (len - i > 255 * 32) ? i + 255 * 32 : len;
+
+		for(; i + 32 <= end; i += 32)
+		{
+			in= _mm256_loadu_si256((const __m256i*) (p + i));
+			leadCount= _mm256_sub_epi8(leadCount, _mm256_cmpgt_epi8(in, lastContinuation));
+			longCount= _mm256_sub_epi8(longCount, _mm256_cmpeq_epi8(_mm256_max_epu8(in, firstLong), in));
+		}
+
+		*leads += unicoder_avx2_sumBytes(leadCount);
+		*longLeads += unicoder_avx2_sumBytes(longCount);
+	}
+
+	return i;
+}
+
+#endif
+
+
+#if defined(UNICODER_SSE)
+
+UNICODER_INLINE UNICODER_TARGET_SSE size_t unicoder_sse_sumBytes(__m128i x)
+{
+	unsigned long long lanes[2];
+
+	_mm_storeu_si128((__m128i*) lanes, _mm_sad_epu8(x, _mm_setzero_si128()));
+	return (size_t) (lanes[0] + lanes[1]);
+}
+
+
+/* counts lead bytes and F0..FF bytes in the first multiple of 16 bytes, returns how many bytes it looked at */
+static UNICODER_TARGET_SSE size_t unicoder_sse_utf8CountLeads(const unsigned char* p, size_t len, size_t* leads, size_t* longLeads)
+{
+	size_t i= 0, end;
+	__m128i in, leadCount, longCount;
+	const __m128i lastContinuation= _mm_set1_epi8((char) 0xbf);
+	const __m128i firstLong= _mm_set1_epi8((char) 0xf0);
+
+	while(i + 16 <= len)
+	{
+		/* the byte counters hold up to 255 before they have to be summed */
+		leadCount= _mm_setzero_si128();
+		longCount= _mm_setzero_si128();
+		end= (len - i > 255 * 16) ? i + 255 * 16 : len;
+
+		for(; i + 16 <= end; i += 16)
+		{
+			in= _mm_loadu_si128((const __m128i*) (p + i));
+			leadCount= _mm_sub_epi8(leadCount, _mm_cmpgt_epi8(in, lastContinuation));
+			longCount= _mm_sub_epi8(longCount, _mm_cmpeq_epi8(_mm_max_epu8(in, firstLong), in));
+		}
+
+		*leads += unicoder_sse_sumBytes(leadCount);
+		*longLeads += unicoder_sse_sumBytes(longCount);
+	}
+
+	return i;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX512)
+
+/* counts lead bytes and F0..FF bytes by the bits of the compare masks, the last partial block under */
+/* a mask, returns len */
+static UNICODER_TARGET_AVX512 size_t unicoder_avx512_utf8CountLeads(const unsigned char* p, size_t len, size_t* leads, size_t* longLeads)
+{
+	size_t i;
+	__m512i in;
+	__mmask64 tail;
+	const __m512i lastContinuation= _mm512_set1_epi8((char) 0xbf);
+	const __m512i firstLong= _mm512_set1_epi8((char) 0xf0);
+
+	for(i= 0; i + 64 <= len; i += 64)
+	{
+		in= _mm512_loadu_si512((const void*) (p + i));
+		*leads += unicoder_bitCount64(_mm512_cmpgt_epi8_mask(in, lastContinuation));
+		*longLeads += unicoder_bitCount64(_mm512_cmpge_epu8_mask(in, firstLong));
+	}
+
+	if(i < len)
+	{
+		tail= ((__mmask64) 1 << (len - i)) - 1;
+		in= _mm512_maskz_loadu_epi8(tail, p + i);
+		*leads += unicoder_bitCount64(_mm512_mask_cmpgt_epi8_mask(tail, in, lastContinuation));
+		*longLeads += unicoder_bitCount64(_mm512_mask_cmpge_epu8_mask(tail, in, firstLong));
+	}
+
+	return len;
+}
+
+#endif
+
+
+/* counts the bytes of well formed utf-8 that start a code point, and those that start a 4 byte one */
+static void unicoder_utf8_countLeads(const unsigned char* p, size_t len, size_t* leads, size_t* longLeads)
+{
+	size_t i= 0;
+
+	*leads= 0;
+	*longLeads= 0;
+
+	if(unicoder_kernels()->utf8CountLeads != NULL)
+		i= unicoder_kernels()->utf8CountLeads(p, len, leads, longLeads);
+
+	/* signed, continuation bytes are the ones from -128 to -65 */
+	for(; i < len; i++)
+	{
+		*leads += ((signed char) p[i] > (signed char) 0xbf);
+		*longLeads += (p[i] >= 0xf0);
+	}
+}
+
+
+/* number of bytes x takes in encoding, or error code if it cannot be encoded */
+UNICODER_INLINE int unicoder_encodedLength(unsigned int x, unsigned int encoding)
+{
+	switch(encoding)
+	{
+		case UNICODER_ASCII:
+			return (x > 0x7f) ? UNICODER_OUT_OF_ASCII_RANGE : 1;
+
+		case UNICODER_UTF8:
+			return 1 + (x > 0x7f) + (x > 0x07ff) + (x > 0xffff);
+
+		case UNICODER_UTF16BE:
+		case UNICODER_UTF16LE:
+			return (x > 0xffff) ? 4 : 2;
+
+		case UNICODER_ISO8859_1:
+			return (x > 0xff) ? UNICODER_NOT_IN_CODE_PAGE : 1;
+
+		case UNICODER_ISO8859_15:
+		case UNICODER_CP1252:
+			return (unicoder_codePage_encode(unicoder_codePageOf(encoding), x) < 0) ? UNICODER_NOT_IN_CODE_PAGE : 1;
+	};
+
+	return 4;
+}
+
+
+/* exact number of bytes unicoder_transcode would write for srcLen bytes of src going from srcEncoding */
+/* to dstEncoding, stored in length; on error length covers what comes before the offending sequence */
+/* returns 0 or the error code unicoder_transcode would return */
+int unicoder_transcodedLength(const unsigned char* src, size_t srcLen, unsigned int srcEncoding,
+                              unsigned int dstEncoding, size_t* length)
+{
+	size_t in= 0, out= 0, valid, leads, longLeads;
+	unsigned int x;
+	int bytesRead, bytesWritten, ret= 0;
+
+	if(length == NULL)
+		return UNICODER_NULL_POINTER;
+
+	*length= 0;
+
+	if(src == NULL  &&  srcLen > 0)
+		return UNICODER_NULL_POINTER;
+
+	if(srcEncoding < UNICODER_ASCII  ||  UNICODER_CP1252 < srcEncoding)
+		return UNICODER_ENCODING_UNRECOGNIZED;
+
+	if(dstEncoding < UNICODER_ASCII  ||  UNICODER_CP1252 < dstEncoding)
+		return UNICODER_ENCODING_UNRECOGNIZED;
+
+	/* utf-8 to a code page goes a code point at a time below, since the code points decide it */
+	if(srcEncoding == UNICODER_UTF8  &&  dstEncoding <= UNICODER_UTF32LE)
+	{
+		ret= unicoder_utf8_validate(src, srcLen, &valid);
+
+		if(dstEncoding == UNICODER_ASCII)
+		{
+			*length= unicoder_asciiPrefix(src, valid);
+			return (*length < valid) ? UNICODER_OUT_OF_ASCII_RANGE : ret;
+		}
+
+		if(dstEncoding == UNICODER_UTF8)
+		{
+			*length= valid;
+			return ret;
+		}
+
+		unicoder_utf8_countLeads(src, valid, &leads, &longLeads);
+
+		if(dstEncoding == UNICODER_UTF16BE  ||  dstEncoding == UNICODER_UTF16LE)
+			*length= 2 * leads + 2 * longLeads;
+		else
+			*length= 4 * leads;
+
+		return ret;
+	}
+
+	while(in < srcLen)
+	{
+		bytesRead= unicoder_readStep(src + in, srcLen - in, &x, srcEncoding);
+		if(bytesRead < 0)
+		{
+			ret= bytesRead;
+			break;
+		}
+
+		bytesWritten= unicoder_encodedLength(x, dstEncoding);
+		if(bytesWritten < 0)
+		{
+			ret= bytesWritten;
+			break;
+		}
+
+		in += bytesRead;
+		out += bytesWritten;
+	}
+
+	*length= out;
+	return ret;
+}
+
+
+/* counts the code points in srcLen bytes of src, stored in count; on error count covers what comes */
+/* before the offending sequence; returns 0 or error code */
+int unicoder_countCodePoints(const unsigned char* src, size_t srcLen, unsigned int srcEncoding, size_t* count)
+{
+	size_t length;
+	int ret;
+
+	if(count == NULL)
+		return UNICODER_NULL_POINTER;
+
+	/* every code point is exactly 4 bytes of utf-32 */
+	ret= unicoder_transcodedLength(src, srcLen, srcEncoding, UNICODER_UTF32LE, &length);
+	*count= length / 4;
+
+	return ret;
+}
+
+
+
+
+
+
+/*
+In place transcoding.
+
+unicoder_transcodeInPlace converts a buffer over itself, front to back, which works as long as the
+output never gets ahead of the input. That always holds when no code point takes more bytes in
+the destination than in the source: anything from utf-32, utf-16 to utf-16, anything to ascii, and
+ascii or utf-8 to ascii or utf-8.
+The pair kernels store whole vectors and may write past what they report, so they never write
+into the buffer itself: each block goes through a bounce buffer on the stack, small enough to stay
+in L1, and is copied back behind the read position once the kernel is done with it. A block is
+all read before any of it is written back, so what has to hold is only that each block's output
+ends no later than its input. The other pairs (utf-16 to utf-8 is the common one, three bytes for
+two past 0x7ff) run the same blocks through the kernels once first with the output thrown away,
+and a buffer that would be overrun is refused before a byte of it changes.
+*/
+
+#define  UNICODER_BOUNCE_SIZE  4096
+
+
+/* whether no code point takes more bytes in dstEncoding than in srcEncoding */
+static int unicoder_neverGrows(unsigned int srcEncoding, unsigned int dstEncoding)
+{
+	if(srcEncoding == dstEncoding  ||  unicoder_isSingleByte(dstEncoding))
+		return 1;
+
+	switch(srcEncoding)
+	{
+		case UNICODER_ASCII:
+			return dstEncoding == UNICODER_UTF8;
+
+		case UNICODER_UTF16BE:
+		case UNICODER_UTF16LE:
+			return dstEncoding == UNICODER_UTF16BE  ||  dstEncoding == UNICODER_UTF16LE;
+
+		case UNICODER_UTF32BE:
+		case UNICODER_UTF32LE:
+			return 1;
+	}
+
+	return 0;
+}
+
+
+/* converts the block of buf starting at in to dstEncoding in bounce; taken and written receive the */
+/* bytes used and made; returns 0 or error code, a code point cut off by the end of the block or a */
+/* full bounce buffer being no error as long as the block got anywhere */
+static int unicoder_inPlaceBlock(const unsigned char* buf, size_t len, size_t in, unsigned int srcEncoding, unsigned int dstEncoding,
+                                 unsigned char* bounce, size_t* taken, size_t* written)
+{
+	size_t block;
+	int ret;
+
+	/* half the bounce buffer, so a block fits even if it doubles (ascii going to utf-16) */
+	block= (len - in < UNICODER_BOUNCE_SIZE / 2) ? len - in : UNICODER_BOUNCE_SIZE / 2;
+
+	ret= unicoder_transcode(buf + in, block, srcEncoding, bounce, UNICODER_BOUNCE_SIZE, dstEncoding, taken, written);
+
+	/* a code point cut off by the end of the block starts the next one */
+	if(ret == UNICODER_INCOMPLETE_SEQUENCE  &&  in + block < len  &&  *taken > 0)
+		ret= 0;
+
+	if(ret == UNICODER_OUTPUT_BUFFER_FULL  &&  *taken > 0)
+		ret= 0;
+
+	return ret;
+}
+
+
+/* whether converting len bytes of buf block by block keeps every block's output behind the end of */
+/* its input; stops at the first bad sequence, where the conversion itself will stop */
+static int unicoder_staysBehind(const unsigned char* buf, size_t len, unsigned int srcEncoding, unsigned int dstEncoding)
+{
+	unsigned char bounce[UNICODER_BOUNCE_SIZE];
+	size_t in= 0, out= 0, taken, written;
+	int ret;
+
+	while(in < len)
+	{
+		ret= unicoder_inPlaceBlock(buf, len, in, srcEncoding, dstEncoding, bounce, &taken, &written);
+		in += taken;
+		out += written;
+
+		if(out > in)
+			return 0;
+
+		if(ret < 0)
+			break;
+	}
+
+	return 1;
+}
+
+
+/* converts len bytes of buf from srcEncoding to dstEncoding over themselves, newLen (may be NULL) */
+/* receives the length of the result; returns 0 or error code, UNICODER_OUTPUT_BUFFER_FULL if the */
+/* output would get ahead of the input, in which case buf is left as it was */
+/* on any other error newLen covers what came before the offending sequence and the rest of buf is lost */
+int unicoder_transcodeInPlace(unsigned char* buf, size_t len, unsigned int srcEncoding, unsigned int dstEncoding,
+                              size_t* newLen)
+{
+	unsigned char bounce[UNICODER_BOUNCE_SIZE];
+	size_t in= 0, out= 0, taken, written;
+	int ret= 0;
+
+	if(newLen != NULL)
+		*newLen= 0;
+
+	if(buf == NULL  &&  len > 0)
+		return UNICODER_NULL_POINTER;
+
+	if(srcEncoding < UNICODER_ASCII  ||  UNICODER_CP1252 < srcEncoding)
+		return UNICODER_ENCODING_UNRECOGNIZED;
+
+	if(dstEncoding < UNICODER_ASCII  ||  UNICODER_CP1252 < dstEncoding)
+		return UNICODER_ENCODING_UNRECOGNIZED;
+
+	if(!unicoder_neverGrows(srcEncoding, dstEncoding)  &&  !unicoder_staysBehind(buf, len, srcEncoding, dstEncoding))
+		return UNICODER_OUTPUT_BUFFER_FULL;
+
+	while(in < len)
+	{
+		ret= unicoder_inPlaceBlock(buf, len, in, srcEncoding, dstEncoding, bounce, &taken, &written);
+		memcpy(buf + out, bounce, written);
+		in += taken;
+		out += written;
+
+		if(ret < 0)
+			break;
+	}
+
+	if(newLen != NULL)
+		*newLen= out;
+
+	return ret;
+}
+
+
+
+
+
+
+/*
+Parallel transcoding.
+
+The source is cut into one chunk per thread, and each cut is moved forward to a code point boundary:
+past utf-8 continuation bytes, past the low half of a utf-16 surrogate pair, and onto a whole unit
+for utf-16 and utf-32. A first pass has every chunk work out how long its output will be, a prefix
+sum turns those into offsets, and a second pass transcodes every chunk into its own slice of dst.
+The first chunk that fails or overflows dst is the only one that can end short, so the result is
+exactly what unicoder_transcode would have returned, error offset included.
+*/
+
+#if defined(UNICODER_THREADS)
+
+#define  UNICODER_PARALLEL_MIN_CHUNK    (1 << 20) /* smaller chunks do not pay for the thread */
+#define  UNICODER_PARALLEL_MAX_THREADS  64
+
+typedef struct
+{
+	const unsigned char* src;
+	size_t srcLen;
+	unsigned int srcEncoding;
+	unsigned char* dst;
+	size_t dstCap;
+	unsigned int dstEncoding;
+	int measure; /* only count the output, dst is not touched */
+	size_t consumed;
+	size_t produced;
+	int ret;
+} unicoder_chunk;
+
+
+/* transcodes the chunk, or in the first pass only works out how long its output is */
+static void* unicoder_chunkWorker(void* arg)
+{
+	unicoder_chunk* c= (unicoder_chunk*) arg;
+
+	if(c->measure)
+		c->ret= unicoder_transcodedLength(c->src, c->srcLen, c->srcEncoding, c->dstEncoding, &c->produced);
+	else
+		c->ret= unicoder_transcode(c->src, c->srcLen, c->srcEncoding, c->dst, c->dstCap, c->dstEncoding,
+		                           &c->consumed, &c->produced);
+
+	return NULL;
+}
+
+
+/* runs every chunk on its own thread, the caller's thread takes the first one */
+static void unicoder_runChunks(unicoder_chunk* chunks, unsigned int count)
+{
+	pthread_t threads[UNICODER_PARALLEL_MAX_THREADS];
+	int started[UNICODER_PARALLEL_MAX_THREADS];
+	unsigned int i;
+
+	for(i= 1; i < count; i++)
+	{
+		started[i]= (pthread_create(&threads[i], NULL, unicoder_chunkWorker, &chunks[i]) == 0);
+
+		/* no thread to be had, do it here */
+		if(!started[i])
+			unicoder_chunkWorker(&chunks[i]);
+	}
+
+	unicoder_chunkWorker(&chunks[0]);
+
+	for(i= 1; i < count; i++)
+	{
+		if(started[i])
+			pthread_join(threads[i], NULL);
+	}
+}
+
+
+/* moves pos forward to the start of a code point */
+static size_t unicoder_chunkBoundary(const unsigned char* src, size_t srcLen, unsigned int encoding, size_t pos)
+{
+	size_t i;
+	unsigned int unit;
+
+	switch(encoding)
+	{
+		case UNICODER_UTF8:
+			/* a code point has at most 3 continuation bytes, more than that is an error the chunk in front reports */
+			for(i= 0; i < 3  &&  pos < srcLen  &&  (src[pos] & 0xc0) == 0x80; i++)
+				pos++;
+			break;
+
+		case UNICODER_UTF16BE:
+		case UNICODER_UTF16LE:
+			pos &= ~(size_t) 1;
+			if(pos + 2 <= srcLen)
+			{
+				unit= unicoder_load16(src + pos, (encoding == UNICODER_UTF16LE) ? UNICODER_LES : UNICODER_BES);
+				if(0xdc00 <= unit  &&  unit <= 0xdfff)
+					pos += 2;
+			}
+			break;
+
+		case UNICODER_UTF32BE:
+		case UNICODER_UTF32LE:
+			pos &= ~(size_t) 3;
+			break;
+	};
+
+	return (pos < srcLen) ? pos : srcLen;
+}
+
+#endif
+
+
+/* same as unicoder_transcode, but splits the work over threads (0 means one per online processor) */
+/* small inputs, a single thread or a build without pthreads go straight to unicoder_transcode */
+int unicoder_transcodeParallel(const unsigned char* src, size_t srcLen, unsigned int srcEncoding,
+                               unsigned char* dst, size_t dstCap, unsigned int dstEncoding,
+                               size_t* consumed, size_t* produced, unsigned int threads)
+{
+#if defined(UNICODER_THREADS)
+	unicoder_chunk chunks[UNICODER_PARALLEL_MAX_THREADS];
+	size_t offsets[UNICODER_PARALLEL_MAX_THREADS];
+	size_t start, end, offset;
+	unsigned int i, last;
+	long online;
+	int ret;
+
+	if(threads == 0)
+	{
+		online= sysconf(_SC_NPROCESSORS_ONLN);
+		threads= (online > 0) ? (unsigned int) online : 1;
+	}
+
+	if(threads > UNICODER_PARALLEL_MAX_THREADS)
+		threads= UNICODER_PARALLEL_MAX_THREADS;
+
+	if(threads > srcLen / UNICODER_PARALLEL_MIN_CHUNK)
+		threads= (unsigned int) (srcLen / UNICODER_PARALLEL_MIN_CHUNK);
+
+	if(threads <= 1
+	   ||  src == NULL  ||  (dst == NULL  &&  dstCap > 0)
+	   ||  srcEncoding < UNICODER_ASCII  ||  UNICODER_CP1252 < srcEncoding
+	   ||  dstEncoding < UNICODER_ASCII  ||  UNICODER_CP1252 < dstEncoding)
+		return unicoder_transcode(src, srcLen, srcEncoding, dst, dstCap, dstEncoding, consumed, produced);
+
+	for(i= 0, start= 0; i < threads; i++)
+	{
+		end= (i + 1 == threads) ? srcLen : unicoder_chunkBoundary(src, srcLen, srcEncoding, srcLen / threads * (i + 1));
+		if(end < start)
+			end= start;
+
+		chunks[i].src= src + start;
+		chunks[i].srcLen= end - start;
+		chunks[i].srcEncoding= srcEncoding;
+		chunks[i].dstEncoding= dstEncoding;
+		chunks[i].measure= 1;
+		start= end;
+	}
+
+	unicoder_runChunks(chunks, threads);
+
+	/* prefix sum, stopping at the first chunk that fails or does not fit */
+	for(i= 0, offset= 0; i < threads; i++)
+	{
+		offsets[i]= offset;
+		if(chunks[i].ret != 0  ||  chunks[i].produced > dstCap - offset)
+			break;
+		offset += chunks[i].produced;
+	}
+
+	last= (i < threads) ? i : threads - 1;
+
+	for(i= 0; i <= last; i++)
+	{
+		chunks[i].dst= dst + offsets[i];
+		chunks[i].dstCap= (i < last) ? chunks[i].produced : dstCap - offsets[i];
+		chunks[i].measure= 0;
+	}
+
+	unicoder_runChunks(chunks, last + 1);
+
+	ret= chunks[last].ret;
+
+	/* a chunk in the middle cut off mid code point was followed by a byte that cannot continue it */
+	if(ret == UNICODER_INCOMPLETE_SEQUENCE  &&  last + 1 < threads)
+		ret= UNICODER_INVALID_BYTE_SEQUENCE;
+
+	if(consumed != NULL)
+		*consumed= (size_t) (chunks[last].src - src) + chunks[last].consumed;
+
+	if(produced != NULL)
+		*produced= offsets[last] + chunks[last].produced;
+
+	return ret;
+#else
+	(void) threads;
+	return unicoder_transcode(src, srcLen, srcEncoding, dst, dstCap, dstEncoding, consumed, produced);
+#endif
+}
+
+
+
+
+
+
+/*
+Incremental decoding.
+
+For input that arrives in pieces of any size, such as reads from a socket. Each chunk is transcoded
+straight from where it lies; a code point cut off by the end of a chunk (at most 3 bytes, which
+covers a high surrogate waiting for its low half) is kept in the decoder and finished off with the
+start of the next chunk, so chunks never need to be joined.
+*/
+
+/* sets up d to turn srcEncoding into dstEncoding (UNICODER_UTF32LE or BE for plain code points), returns 0 or error code */
+int unicoder_decoder_init(unicoder_decoder* d, unsigned int srcEncoding, unsigned int dstEncoding)
+{
+	if(d == NULL)
+		return UNICODER_NULL_POINTER;
+
+	if(srcEncoding < UNICODER_ASCII  ||  UNICODER_CP1252 < srcEncoding)
+		return UNICODER_ENCODING_UNRECOGNIZED;
+
+	if(dstEncoding < UNICODER_ASCII  ||  UNICODER_CP1252 < dstEncoding)
+		return UNICODER_ENCODING_UNRECOGNIZED;
+
+	d->srcEncoding= srcEncoding;
+	d->dstEncoding= dstEncoding;
+	d->pendingLen= 0;
+
+	return 0;
+}
+
+
+/* converts the next srcLen bytes of the stream into dst (at most dstCap bytes) */
+/* consumed and produced (either may be NULL) work as for unicoder_transcode; bytes held back for */
+/* the next chunk count as consumed; returns 0 or error code, UNICODER_OUTPUT_BUFFER_FULL means */
+/* call again with the rest of the chunk */
+int unicoder_decoder_decode(unicoder_decoder* d, const unsigned char* src, size_t srcLen,
+                            unsigned char* dst, size_t dstCap, size_t* consumed, size_t* produced)
+{
+	size_t in= 0, out= 0, pendingLen, c, p;
+	int ret= 0;
+
+	if(consumed != NULL)
+		*consumed= 0;
+
+	if(produced != NULL)
+		*produced= 0;
+
+	if(d == NULL)
+		return UNICODER_NULL_POINTER;
+
+	if((src == NULL  &&  srcLen > 0)  ||  (dst == NULL  &&  dstCap > 0))
+		return UNICODER_NULL_POINTER;
+
+	if(d->pendingLen > 0  &&  srcLen > 0)
+	{
+		pendingLen= d->pendingLen;
+		ret= unicoder_completePending(d->pending, &pendingLen, src, srcLen, d->srcEncoding,
+		                              dst, dstCap, d->dstEncoding, &in, &out);
+		d->pendingLen= (unsigned int) pendingLen;
+	}
+
+	if(ret == 0  &&  in < srcLen)
+	{
+		ret= unicoder_transcode(src + in, srcLen - in, d->srcEncoding, dst + out, dstCap - out, d->dstEncoding, &c, &p);
+		in += c;
+		out += p;
+
+		/* the end of the chunk cut a code point short, hold on to what there is of it */
+		if(ret == UNICODER_INCOMPLETE_SEQUENCE)
+		{
+			memcpy(d->pending, src + in, srcLen - in);
+			d->pendingLen= (unsigned int) (srcLen - in);
+			in= srcLen;
+			ret= 0;
+		}
+	}
+
+	if(consumed != NULL)
+		*consumed= in;
+
+	if(produced != NULL)
+		*produced= out;
+
+	return ret;
+}
+
+
+/* ends the stream, returns UNICODER_INCOMPLETE_SEQUENCE if it stopped in the middle of a code point, 0 otherwise */
+/* d is ready for a new stream afterwards */
+int unicoder_decoder_finish(unicoder_decoder* d)
+{
+	int ret;
+
+	if(d == NULL)
+		return UNICODER_NULL_POINTER;
+
+	ret= (d->pendingLen > 0) ? UNICODER_INCOMPLETE_SEQUENCE : 0;
+	d->pendingLen= 0;
+
+	return ret;
+}
+
+
+
+
+
+
+/*
+Lossy transcoding.
+
+Bulk transcoding stops at the first bad sequence. For input that is mostly clean, such as logs,
+unicoder_transcodeLossy keeps going instead: it hands the source to unicoder_transcode, so valid
+stretches still run through the pair kernels and their vector paths, and only when one of them
+stops does it deal with the one bad sequence there and start it again right after it. A bad
+sequence is cut into maximal subparts (Unicode chapter 3, "U+FFFD Substitution of Maximal
+Subparts", which is also what the WHATWG decoders do): the longest start of a well formed
+sequence, or a single byte if there is none, so "\xe2\x82" followed by "A" is one U+FFFD and
+an "A", while "\xc0\x80" is two. A code point the destination cannot take (anything past 0x7f
+going to ascii, or missing from a code page) is dropped or replaced whole, with '?' since ascii
+and the code pages have no U+FFFD.
+*/
+
+/* bytes at p (avail > 0) that make up the maximal subpart of the bad sequence starting there */
+static size_t unicoder_maximalSubpart(const unsigned char* p, size_t avail, unsigned int encoding)
+{
+	unsigned int state;
+	size_t i;
+
+	switch(encoding)
+	{
+		case UNICODER_UTF8:
+			state= unicoder_utf8Transition[unicoder_utf8Class[p[0]]];
+			for(i= 1; i < avail  &&  state > UNICODER_UTF8_REJECT; i++)
+			{
+				state= unicoder_utf8Transition[state + unicoder_utf8Class[p[i]]];
+				if(state == UNICODER_UTF8_REJECT)
+					break;
+			}
+
+			return i;
+
+		/* a high surrogate cut off by the end goes with whatever is left of the source */
+		case UNICODER_UTF16BE:
+			if(avail >= 2  &&  avail < 4  &&  (p[0] & 0xfc) == 0xd8)
+				return avail;
+
+			return (avail < 2) ? avail : 2;
+
+		case UNICODER_UTF16LE:
+			if(avail >= 2  &&  avail < 4  &&  (p[1] & 0xfc) == 0xd8)
+				return avail;
+
+			return (avail < 2) ? avail : 2;
+
+		case UNICODER_UTF32BE:
+		case UNICODER_UTF32LE:
+			return (avail < 4) ? avail : 4;
+	}
+
+	return 1;
+}
+
+
+/* same as unicoder_transcode, but what it does with a bad sequence, or a code point dstEncoding */
+/* cannot take, is up to policy; errorOffsets (may be NULL if maxErrors is 0) receives the offsets */
+/* of the first maxErrors of them and errorCount (may be NULL) how many there were; returns 0, */
+/* UNICODER_OUTPUT_BUFFER_FULL (call again from consumed) or error code */
+int unicoder_transcodeLossy(const unsigned char* src, size_t srcLen, unsigned int srcEncoding,
+                            unsigned char* dst, size_t dstCap, unsigned int dstEncoding, unsigned int policy,
+                            size_t* errorOffsets, size_t maxErrors, size_t* errorCount,
+                            size_t* consumed, size_t* produced)
+{
+	size_t in= 0, out= 0, errors= 0, taken, written, bad;
+	unsigned char replacement[4];
+	unsigned int x;
+	int ret, length= 0;
+
+	if(consumed != NULL)
+		*consumed= 0;
+
+	if(produced != NULL)
+		*produced= 0;
+
+	if(errorCount != NULL)
+		*errorCount= 0;
+
+	if(policy > UNICODER_POLICY_SKIP)
+		return UNICODER_NOT_SUPPORTED;
+
+	if(errorOffsets == NULL  &&  maxErrors > 0)
+		return UNICODER_NULL_POINTER;
+
+	if(policy == UNICODER_POLICY_REPLACE)
+	{
+		length= unicoder_writeCodePoint(replacement, 0xfffd, dstEncoding);
+		if(length == UNICODER_OUT_OF_ASCII_RANGE  ||  length == UNICODER_NOT_IN_CODE_PAGE)
+		{
+			replacement[0]= '?';
+			length= 1;
+		}
+	}
+
+	for(;;)
+	{
+		ret= unicoder_transcode(src + in, srcLen - in, srcEncoding, dst + out, dstCap - out, dstEncoding, &taken, &written);
+		in += taken;
+		out += written;
+
+		if(ret != UNICODER_INVALID_BYTE_SEQUENCE  &&  ret != UNICODER_INVALID_CODE_POINT
+		                                          &&  ret != UNICODER_OUT_OF_ASCII_RANGE
+		                                          &&  ret != UNICODER_NOT_IN_CODE_PAGE
+		                                          &&  ret != UNICODER_INCOMPLETE_SEQUENCE)
+			break;
+
+		if(policy == UNICODER_POLICY_REPLACE  &&  (size_t) length > dstCap - out)
+		{
+			ret= UNICODER_OUTPUT_BUFFER_FULL;
+			break;
+		}
+
+		if(errors < maxErrors)
+			errorOffsets[errors]= in;
+
+		errors++;
+
+		if(policy == UNICODER_POLICY_STRICT)
+			break;
+
+		/* a sequence that reads fine is a code point the destination refused, it goes whole */
+		ret= unicoder_readStep(src + in, srcLen - in, &x, srcEncoding);
+		bad= (ret > 0) ? (size_t) ret : unicoder_maximalSubpart(src + in, srcLen - in, srcEncoding);
+
+		if(policy == UNICODER_POLICY_REPLACE)
+		{
+			memcpy(dst + out, replacement, length);
+			out += length;
+		}
+
+		in += bad;
+	}
+
+	if(consumed != NULL)
+		*consumed= in;
+
+	if(produced != NULL)
+		*produced= out;
+
+	if(errorCount != NULL)
+		*errorCount= errors;
+
+	return ret;
+}
+
+
+
+
+
+
+/*
+Character properties.
+
+General category, canonical combining class and NFC_Quick_Check for every code point, from the
+tables unicoder_tables.py generates: the top bits of a code point pick a block of property numbers,
+the bottom bits one of them, and the number picks one of the few distinct property triples.
+That is two dependent byte loads per lookup, in about 40k of tables of which ordinary text only
+ever touches a few blocks.
+
+The quick check is the one of uax #15. Nothing below U+0300 combines or leaves nfc, and in well
+formed utf-8 the code points from U+0300 up are the ones whose lead byte is CC or above. So utf-8
+is validated with the vector kernels a block at a time, runs of smaller bytes in the block (ascii
+and latin alike) are then skipped a vector at a time, and only the code points past U+0300 are
+decoded and looked up.
+*/
+
+typedef struct
+{
+	unsigned char category;
+	unsigned char combiningClass;
+	unsigned char nfcQuickCheck;
+} unicoder_property;
+
+#include "unicoder_tables.h"
+
+/* the first code point with a nonzero combining class or a quick check other than yes, and its utf-8 lead */
+#define  UNICODER_FIRST_COMBINING       0x300
+#define  UNICODER_UTF8_FIRST_COMBINING  0xcc
+
+/* bytes of utf-8 the quick check validates at a time */
+#define  UNICODER_QUICK_CHECK_BLOCK  16384
+
+
+UNICODER_INLINE const unicoder_property* unicoder_propertyOf(unsigned int x)
+{
+	unsigned int entry;
+
+	if(x > 0x10ffff)
+		return &unicoder_properties[0];
+
+	entry= ((unsigned int) unicoder_propertyBlocks[x >> UNICODER_PROPERTY_SHIFT] << UNICODER_PROPERTY_SHIFT)
+	     | (x & ((1u << UNICODER_PROPERTY_SHIFT) - 1));
+	return &unicoder_properties[unicoder_propertyIndex[entry]];
+}
+
+
+/* general category of code point x, one of the UNICODER_CATEGORY_ constants */
+unsigned int unicoder_generalCategory(unsigned int x)
+{
+	return unicoder_propertyOf(x)->category;
+}
+
+
+/* canonical combining class of code point x, 0 for starters */
+unsigned int unicoder_combiningClass(unsigned int x)
+{
+	return unicoder_propertyOf(x)->combiningClass;
+}
+
+
+/* NFC_Quick_Check property of code point x, UNICODER_NFC_YES, UNICODER_NFC_NO or UNICODER_NFC_MAYBE */
+unsigned int unicoder_nfcQuickCheckCodePoint(unsigned int x)
+{
+	return unicoder_propertyOf(x)->nfcQuickCheck;
+}
+
+
+#if defined(UNICODER_AVX2)
+
+/* skips whole 32 byte blocks of bytes below limit, returns how many bytes it took care of */
+static UNICODER_TARGET_AVX2 size_t unicoder_avx2_skipBelow(const unsigned char* p, size_t len, unsigned char limit)
+{
+	size_t i;
+	__m256i in;
+	const __m256i bound= _mm256_set1_epi8((char) limit);
+
+	for(i= 0; i + 32 <= len; i += 32)
+	{
+		in= _mm256_loadu_si256((const __m256i*) (p + i));
+		if(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(in, bound), in)) != 0)
+			break;
+	}
+
+	return i;
+}
+
+#endif
+
+
+#if defined(UNICODER_SSE)
+
+/* skips whole 16 byte blocks of bytes below limit, returns how many bytes it took care of */
+static UNICODER_TARGET_SSE size_t unicoder_sse_skipBelow(const unsigned char* p, size_t len, unsigned char limit)
+{
+	size_t i;
+	__m128i in;
+	const __m128i bound= _mm_set1_epi8((char) limit);
+
+	for(i= 0; i + 16 <= len; i += 16)
+	{
+		in= _mm_loadu_si128((const __m128i*) (p + i));
+		if(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(in, bound), in)) != 0)
+			break;
+	}
+
+	return i;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX512)
+
+/* skips whole 64 byte blocks of bytes below limit, the last partial block under a mask, returns how */
+/* many bytes it took care of */
+static UNICODER_TARGET_AVX512 size_t unicoder_avx512_skipBelow(const unsigned char* p, size_t len, unsigned char limit)
+{
+	size_t i;
+	__mmask64 tail;
+	const __m512i bound= _mm512_set1_epi8((char) limit);
+
+	for(i= 0; i + 64 <= len; i += 64)
+	{
+		if(_mm512_cmpge_epu8_mask(_mm512_loadu_si512((const void*) (p + i)), bound) != 0)
+			return i;
+	}
+
+	if(i < len)
+	{
+		tail= ((__mmask64) 1 << (len - i)) - 1;
+		if(_mm512_mask_cmpge_epu8_mask(tail, _mm512_maskz_loadu_epi8(tail, p + i), bound) == 0)
+			return len;
+	}
+
+	return i;
+}
+
+#endif
+
+
+/* decodes the code point at p, which must start well formed utf-8, into cp; returns its length */
+UNICODER_INLINE int unicoder_utf8_readValid(const unsigned char* p, unsigned int* cp)
+{
+	if(p[0] < 0x80)
+	{
+		*cp= p[0];
+		return 1;
+	}
+
+	if(p[0] < 0xe0)
+	{
+		*cp= ((p[0] & 0x1fu) << 6) | (p[1] & 0x3fu);
+		return 2;
+	}
+
+	if(p[0] < 0xf0)
+	{
+		*cp= ((p[0] & 0x0fu) << 12) | ((p[1] & 0x3fu) << 6) | (p[2] & 0x3fu);
+		return 3;
+	}
+
+	*cp= ((p[0] & 0x07u) << 18) | ((p[1] & 0x3fu) << 12) | ((p[2] & 0x3fu) << 6) | (p[3] & 0x3fu);
+	return 4;
+}
+
+
+/* quick check of len bytes at buf in encoding against normalization form C (uax #15) */
+/* returns UNICODER_NFC_YES, UNICODER_NFC_NO, UNICODER_NFC_MAYBE or error code for a bad sequence */
+int unicoder_nfcQuickCheck(const unsigned char* buf, size_t len, unsigned int encoding)
+{
+	size_t in= 0, end= 0, valid, i;
+	unsigned int x, lastClass= 0;
+	int bytesRead, bad= 0, result= UNICODER_NFC_YES;
+	const unicoder_property* property;
+
+	if(buf == NULL  &&  len > 0)
+		return UNICODER_NULL_POINTER;
+
+	if(encoding < UNICODER_ASCII  ||  UNICODER_CP1252 < encoding)
+		return UNICODER_ENCODING_UNRECOGNIZED;
+
+	if(encoding == UNICODER_ASCII)
+		return (unicoder_skipBelow(buf, len, 0x80) == len) ? UNICODER_NFC_YES : UNICODER_INVALID_BYTE_SEQUENCE;
+
+	/* every character of the code pages is a starter nfc leaves alone */
+	if(encoding >= UNICODER_ISO8859_1)
+		return UNICODER_NFC_YES;
+
+	while(in < len)
+	{
+		/* utf-8 is validated a block at a time, cut before a lead byte, so the block is still in cache */
+		/* for the scan; once it is known to be well formed, every byte below CC belongs to a code point */
+		/* below U+0300 */
+		if(encoding == UNICODER_UTF8)
+		{
+			if(in >= end)
+			{
+				if(bad < 0)
+					return bad;
+
+				end= (len - in > UNICODER_QUICK_CHECK_BLOCK) ? in + UNICODER_QUICK_CHECK_BLOCK : len;
+				for(i= 0; i < 3  &&  end < len  &&  (buf[end] & 0xc0) == 0x80; i++)
+					end--;
+
+				/* a bad block is validated again to the end of buf, for where the first bad sequence */
+				/* really is; the scan stops there */
+				if(unicoder_utf8_validate(buf + in, end - in, NULL) < 0)
+				{
+					bad= unicoder_utf8_validate(buf + in, len - in, &valid);
+					end= in + valid;
+					continue;
+				}
+			}
+
+			if(buf[in] < UNICODER_UTF8_FIRST_COMBINING)
+			{
+				/* the spaces between words are not worth a vector, longer runs are */
+				for(i= 0; i < 8  &&  in < end  &&  buf[in] < UNICODER_UTF8_FIRST_COMBINING; i++)
+					in++;
+
+				if(i == 8)
+					in += unicoder_skipBelow(buf + in, end - in, UNICODER_UTF8_FIRST_COMBINING);
+
+				lastClass= 0;
+				continue;
+			}
+
+			in += unicoder_utf8_readValid(buf + in, &x);
+		}
+
+		else
+		{
+			bytesRead= unicoder_readStep(buf + in, len - in, &x, encoding);
+			if(bytesRead < 0)
+				return bytesRead;
+
+			in += bytesRead;
+
+			if(x < UNICODER_FIRST_COMBINING)
+			{
+				lastClass= 0;
+				continue;
+			}
+		}
+
+		property= unicoder_propertyOf(x);
+
+		/* marks out of canonical order are never nfc */
+		if(property->combiningClass != 0  &&  property->combiningClass < lastClass)
+			return UNICODER_NFC_NO;
+
+		if(property->nfcQuickCheck == UNICODER_NFC_NO)
+			return UNICODER_NFC_NO;
+
+		if(property->nfcQuickCheck == UNICODER_NFC_MAYBE)
+			result= UNICODER_NFC_MAYBE;
+
+		lastClass= property->combiningClass;
+	}
+
+	return result;
+}
+
+
+
+
+
+
+/*
+Case folding.
+
+Simple case folding, the C and S lines of CaseFolding.txt, where every code point folds to exactly
+one other. The tables unicoder_tables.py generates hold what folding adds to each code point, in
+two stages like the character properties. Each encoding gets its own loop from its read and write
+steps, so the folding comes out in the encoding it went in, with no trip through utf-32.
+
+Runs of ascii are folded by the vector kernels. In utf-8 they also take U+0080..U+00FF, whose lead
+bytes are C2 and C3: of those only C3 80..9E (less 97, the multiplication sign) fold, by 20 in the
+second byte, and C2 B5 (micro sign, which folds to greek mu) is left to the scalar loop. The kernels
+check the structure of the 2 byte sequences as they go, so bad utf-8 also ends up in the scalar loop,
+where the read step reports it.
+*/
+
+/* what the loop of an encoding hands to the vector kernels */
+#define  UNICODER_FOLD_NONE   0
+#define  UNICODER_FOLD_ASCII  1
+#define  UNICODER_FOLD_UTF8   2
+
+
+UNICODER_INLINE unsigned int unicoder_foldAscii(unsigned int c)
+{
+	return (c - 'A' < 26) ? c + 0x20 : c;
+}
+
+
+UNICODER_INLINE unsigned int unicoder_foldCodePoint(unsigned int x)
+{
+	unsigned int entry;
+
+	if(x < 0x80)
+		return unicoder_foldAscii(x);
+
+	if(x > 0x10ffff)
+		return x;
+
+	entry= ((unsigned int) unicoder_foldBlocks[x >> UNICODER_FOLD_SHIFT] << UNICODER_FOLD_SHIFT)
+	     | (x & ((1u << UNICODER_FOLD_SHIFT) - 1));
+	return x + (unsigned int) unicoder_foldDeltas[unicoder_foldIndex[entry]];
+}
+
+
+/* simple case folding of code point x, x itself if it does not fold */
+unsigned int unicoder_foldCase(unsigned int x)
+{
+	return unicoder_foldCodePoint(x);
+}
+
+
+#if defined(UNICODER_SSE)
+
+UNICODER_INLINE UNICODER_TARGET_SSE __m128i unicoder_sse_foldAscii(__m128i in)
+{
+	__m128i offset= _mm_sub_epi8(in, _mm_set1_epi8('A'));
+	__m128i upper= _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(25)), offset);
+
+	return _mm_add_epi8(in, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+
+
+/* folds whole 16 byte blocks of ascii from src to dst, returns how many bytes it took care of */
+static UNICODER_TARGET_SSE size_t unicoder_sse_asciiFold(const unsigned char* src, unsigned char* dst, size_t len)
+{
+	size_t i;
+	__m128i in;
+
+	for(i= 0; i + 16 <= len; i += 16)
+	{
+		in= _mm_loadu_si128((const __m128i*) (src + i));
+		if(_mm_movemask_epi8(in) != 0)
+			break;
+
+		_mm_storeu_si128((__m128i*) (dst + i), unicoder_sse_foldAscii(in));
+	}
+
+	return i;
+}
+
+
+/* folds 16 byte windows of utf-8 made of ascii and C2/C3 sequences from src to dst, stopping at */
+/* the first window with anything else; a window ending in a lead byte is taken up to it */
+/* returns how many bytes it took care of, always a whole number of code points */
+static UNICODER_TARGET_SSE size_t unicoder_sse_utf8Fold(const unsigned char* src, unsigned char* dst, size_t len)
+{
+	size_t i= 0;
+	__m128i in, c2, c3, lead, continuation, bad, latin;
+
+	while(i + 16 <= len)
+	{
+		in= _mm_loadu_si128((const __m128i*) (src + i));
+		c2= _mm_cmpeq_epi8(in, _mm_set1_epi8((char) 0xc2));
+		c3= _mm_cmpeq_epi8(in, _mm_set1_epi8((char) 0xc3));
+		lead= _mm_or_si128(c2, c3);
+
+		/* signed, continuation bytes are the ones from -128 to -65 */
+		continuation= _mm_cmplt_epi8(in, _mm_set1_epi8((char) 0xc0));
+
+		/* other leads, continuations not after a lead, leads not followed by one, the micro sign */
+		bad= _mm_andnot_si128(lead, _mm_cmpeq_epi8(_mm_max_epu8(in, _mm_set1_epi8((char) 0xc0)), in));
+		bad= _mm_or_si128(bad, _mm_xor_si128(continuation, _mm_slli_si128(lead, 1)));
+		bad= _mm_or_si128(bad, _mm_and_si128(_mm_slli_si128(c2, 1), _mm_cmpeq_epi8(in, _mm_set1_epi8((char) 0xb5))));
+
+		if(_mm_movemask_epi8(bad) != 0)
+			break;
+
+		latin= _mm_and_si128(_mm_slli_si128(c3, 1), _mm_cmpeq_epi8(_mm_min_epu8(in, _mm_set1_epi8((char) 0x9e)), in));
+		latin= _mm_andnot_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8((char) 0x97)), latin);
+
+		in= _mm_add_epi8(unicoder_sse_foldAscii(in), _mm_and_si128(latin, _mm_set1_epi8(0x20)));
+		_mm_storeu_si128((__m128i*) (dst + i), in);
+
+		/* a lead in the last byte is checked again, with its continuation, as the next window starts */
+		i += 16 - ((unsigned int) _mm_movemask_epi8(lead) >> 15);
+	}
+
+	return i;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX2)
+
+UNICODER_INLINE UNICODER_TARGET_AVX2 __m256i unicoder_avx2_foldAscii(__m256i in)
+{
+	__m256i offset= _mm256_sub_epi8(in, _mm256_set1_epi8('A'));
+	__m256i upper= _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(25)), offset);
+
+	return _mm256_add_epi8(in, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+}
+
+
+/* each byte moved up one place across both lanes, zero in the first */
+UNICODER_INLINE UNICODER_TARGET_AVX2 __m256i unicoder_avx2_previousByte(__m256i x)
+{
+	return _mm256_alignr_epi8(x, _mm256_permute2x128_si256(x, x, 0x08), 15);
+}
+
+
+/* folds whole 32 byte blocks of ascii from src to dst, returns how many bytes it took care of */
+static UNICODER_TARGET_AVX2 size_t unicoder_avx2_asciiFold(const unsigned char* src, unsigned char* dst, size_t len)
+{
+	size_t i;
+	__m256i in;
+
+	for(i= 0; i + 32 <= len; i += 32)
+	{
+		in= _mm256_loadu_si256((const __m256i*) (src + i));
+		if(_mm256_movemask_epi8(in) != 0)
+			break;
+
+		_mm256_storeu_si256((__m256i*) (dst + i), unicoder_avx2_foldAscii(in));
+	}
+
+	return i;
+}
+
+
+/* same as unicoder_sse_utf8Fold with 32 byte windows */
+static UNICODER_TARGET_AVX2 size_t unicoder_avx2_utf8Fold(const unsigned char* src, unsigned char* dst, size_t len)
+{
+	size_t i= 0;
+	__m256i in, c2, c3, lead, continuation, bad, latin;
+
+	while(i + 32 <= len)
+	{
+		in= _mm256_loadu_si256((const __m256i*) (src + i));
+		c2= _mm256_cmpeq_epi8(in, _mm256_set1_epi8((char) 0xc2));
+		c3= _mm256_cmpeq_epi8(in, _mm256_set1_epi8((char) 0xc3));
+		lead= _mm256_or_si256(c2, c3);
+		continuation= _mm256_cmpgt_epi8(_mm256_set1_epi8((char) 0xc0), in);
+
+		bad= _mm256_andnot_si256(lead, _mm256_cmpeq_epi8(_mm256_max_epu8(in, _mm256_set1_epi8((char) 0xc0)), in));
+		bad= _mm256_or_si256(bad, _mm256_xor_si256(continuation, unicoder_avx2_previousByte(lead)));
+		bad= _mm256_or_si256(bad, _mm256_and_si256(unicoder_avx2_previousByte(c2), _mm256_cmpeq_epi8(in, _mm256_set1_epi8((char) 0xb5))));
+
+		if(_mm256_movemask_epi8(bad) != 0)
+			break;
+
+		latin= _mm256_and_si256(unicoder_avx2_previousByte(c3), _mm256_cmpeq_epi8(_mm256_min_epu8(in, _mm256_set1_epi8((char) 0x9e)), in));
+		latin= _mm256_andnot_si256(_mm256_cmpeq_epi8(in, _mm256_set1_epi8((char) 0x97)), latin);
+
+		in= _mm256_add_epi8(unicoder_avx2_foldAscii(in), _mm256_and_si256(latin, _mm256_set1_epi8(0x20)));
+		_mm256_storeu_si256((__m256i*) (dst + i), in);
+		i += 32 - ((unsigned int) _mm256_movemask_epi8(lead) >> 31);
+	}
+
+	return i;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX512)
+
+/* folds whole 64 byte blocks of ascii from src to dst, returns how many bytes it took care of */
+static UNICODER_TARGET_AVX512 size_t unicoder_avx512_asciiFold(const unsigned char* src, unsigned char* dst, size_t len)
+{
+	size_t i;
+	__m512i in;
+	__mmask64 upper;
+
+	for(i= 0; i + 64 <= len; i += 64)
+	{
+		in= _mm512_loadu_si512((const void*) (src + i));
+		if(_mm512_movepi8_mask(in) != 0)
+			break;
+
+		upper= _mm512_cmple_epu8_mask(_mm512_sub_epi8(in, _mm512_set1_epi8('A')), _mm512_set1_epi8(25));
+		_mm512_storeu_si512((void*) (dst + i), _mm512_mask_add_epi8(in, upper, in, _mm512_set1_epi8(0x20)));
+	}
+
+	return i;
+}
+
+
+/* same as unicoder_sse_utf8Fold with 64 byte windows, the byte before each is a shift of the masks */
+static UNICODER_TARGET_AVX512 size_t unicoder_avx512_utf8Fold(const unsigned char* src, unsigned char* dst, size_t len)
+{
+	size_t i= 0;
+	__m512i in;
+	__mmask64 c2, c3, lead, continuation, bad, fold;
+
+	while(i + 64 <= len)
+	{
+		in= _mm512_loadu_si512((const void*) (src + i));
+		c2= _mm512_cmpeq_epi8_mask(in, _mm512_set1_epi8((char) 0xc2));
+		c3= _mm512_cmpeq_epi8_mask(in, _mm512_set1_epi8((char) 0xc3));
+		lead= c2 | c3;
+		continuation= _mm512_cmplt_epi8_mask(in, _mm512_set1_epi8((char) 0xc0));
+
+		bad= _mm512_cmpge_epu8_mask(in, _mm512_set1_epi8((char) 0xc0)) & ~lead;
+		bad |= continuation ^ (lead << 1);
+		bad |= (c2 << 1) & _mm512_cmpeq_epi8_mask(in, _mm512_set1_epi8((char) 0xb5));
+
+		if(bad != 0)
+			break;
+
+		fold= _mm512_cmple_epu8_mask(_mm512_sub_epi8(in, _mm512_set1_epi8('A')), _mm512_set1_epi8(25));
+		fold |= (c3 << 1) & _mm512_cmple_epu8_mask(in, _mm512_set1_epi8((char) 0x9e)) & _mm512_cmpneq_epi8_mask(in, _mm512_set1_epi8((char) 0x97));
+
+		_mm512_storeu_si512((void*) (dst + i), _mm512_mask_add_epi8(in, fold, in, _mm512_set1_epi8(0x20)));
+		i += 64 - (unsigned int) (lead >> 63);
+	}
+
+	return i;
+}
+
+#endif
+
+
+/* folds the run of ascii (utf-8 for UNICODER_FOLD_UTF8, see the kernels) at the start of src into dst */
+/* len is the smaller of what src has and dst can take; returns how many bytes it took care of */
+static size_t unicoder_foldRun(const unsigned char* src, unsigned char* dst, size_t len, unsigned int run)
+{
+	size_t i= 0;
+	size_t (*kernel)(const unsigned char* src, unsigned char* dst, size_t len);
+
+	/* a few bytes by hand first, the spaces between words are not worth a vector */
+	for(; i < 8  &&  i < len  &&  src[i] < 0x80; i++)
+		dst[i]= (unsigned char) unicoder_foldAscii(src[i]);
+
+	if(i < 8)
+		return i;
+
+	kernel= (run == UNICODER_FOLD_UTF8) ? unicoder_kernels()->utf8Fold : unicoder_kernels()->asciiFold;
+	if(kernel != NULL)
+		i += kernel(src + i, dst + i, len - i);
+
+	for(; i < len  &&  src[i] < 0x80; i++)
+		dst[i]= (unsigned char) unicoder_foldAscii(src[i]);
+
+	return i;
+}
+
+
+/* stamps out the folding loop of one encoding; a code point whose folding the encoding cannot hold */
+/* (the micro sign in the code pages) is written as it was */
+#define  UNICODER_DEFINE_FOLDER(name, readStep, writeStep, run)                        \
+static int name(const unsigned char* src, size_t srcLen,                               \
+                unsigned char* dst, size_t dstCap,                                     \
+                size_t* consumed, size_t* produced)                                    \
+{                                                                                      \
+	size_t in= 0, out= 0, limit, done;                                                 \
+	int bytesRead, bytesWritten, ret= 0;                                               \
+	unsigned int x;                                                                    \
+                                                                                       \
+	while(in < srcLen)                                                                 \
+	{                                                                                  \
+		if(run != UNICODER_FOLD_NONE  &&  src[in] < 0x80)                              \
+		{                                                                              \
+			limit= (srcLen - in < dstCap - out) ? srcLen - in : dstCap - out;          \
+			done= unicoder_foldRun(src + in, dst + out, limit, run);                   \
+			in += done;                                                                \
+			out += done;                                                               \
+			if(done > 0)                                                               \
+				continue;                                                              \
+		}                                                                              \
+                                                                                       \
+		bytesRead= readStep(src + in, srcLen - in, &x);                                \
+		if(bytesRead < 0)                                                              \
+		{                                                                              \
+			ret= bytesRead;                                                            \
+			break;                                                                     \
+		}                                                                              \
+                                                                                       \
+		bytesWritten= writeStep(dst + out, dstCap - out, unicoder_foldCodePoint(x));   \
+		if(bytesWritten == UNICODER_NOT_IN_CODE_PAGE)                                  \
+			bytesWritten= writeStep(dst + out, dstCap - out, x);                       \
+                                                                                       \
+		if(bytesWritten < 0)                                                           \
+		{                                                                              \
+			ret= bytesWritten;                                                         \
+			break;                                                                     \
+		}                                                                              \
+                                                                                       \
+		in += bytesRead;                                                               \
+		out += bytesWritten;                                                           \
+	}                                                                                  \
+                                                                                       \
+	*consumed= in;                                                                     \
+	*produced= out;                                                                    \
+	return ret;                                                                        \
+}
+
+UNICODER_DEFINE_FOLDER(unicoder_fold_ascii,      unicoder_ascii_read,      unicoder_ascii_write,      UNICODER_FOLD_ASCII)
+UNICODER_DEFINE_FOLDER(unicoder_fold_utf8,       unicoder_utf8_read,       unicoder_utf8_write,       UNICODER_FOLD_UTF8)
+UNICODER_DEFINE_FOLDER(unicoder_fold_utf16be,    unicoder_utf16be_read,    unicoder_utf16be_write,    UNICODER_FOLD_NONE)
+UNICODER_DEFINE_FOLDER(unicoder_fold_utf16le,    unicoder_utf16le_read,    unicoder_utf16le_write,    UNICODER_FOLD_NONE)
+UNICODER_DEFINE_FOLDER(unicoder_fold_utf32be,    unicoder_utf32be_read,    unicoder_utf32be_write,    UNICODER_FOLD_NONE)
+UNICODER_DEFINE_FOLDER(unicoder_fold_utf32le,    unicoder_utf32le_read,    unicoder_utf32le_write,    UNICODER_FOLD_NONE)
+UNICODER_DEFINE_FOLDER(unicoder_fold_iso8859_1,  unicoder_iso8859_1_read,  unicoder_iso8859_1_write,  UNICODER_FOLD_ASCII)
+UNICODER_DEFINE_FOLDER(unicoder_fold_iso8859_15, unicoder_iso8859_15_read, unicoder_iso8859_15_write, UNICODER_FOLD_ASCII)
+UNICODER_DEFINE_FOLDER(unicoder_fold_cp1252,     unicoder_cp1252_read,     unicoder_cp1252_write,     UNICODER_FOLD_ASCII)
+
+/* indexed by encoding - 1 */
+static const unicoder_transcoder unicoder_folders[9]=
+{
+	unicoder_fold_ascii, unicoder_fold_utf8, unicoder_fold_utf16be, unicoder_fold_utf16le, unicoder_fold_utf32be,
+	unicoder_fold_utf32le, unicoder_fold_iso8859_1, unicoder_fold_iso8859_15, unicoder_fold_cp1252
+};
+
+
+/* simple case folding of srcLen bytes of src into dst (at most dstCap bytes), in the same encoding */
+/* consumed and produced (either may be NULL) work as for unicoder_transcode; a code point whose */
+/* folding a code page cannot hold is left as it is; dst may be src itself for any encoding but */
+/* utf-8, whose foldings can be longer, and must not overlap it otherwise; returns 0 or error code */
+int unicoder_caseFold(const unsigned char* src, size_t srcLen, unsigned int encoding,
+                      unsigned char* dst, size_t dstCap, size_t* consumed, size_t* produced)
+{
+	size_t in= 0, out= 0;
+	int ret;
+
+	if(consumed != NULL)
+		*consumed= 0;
+
+	if(produced != NULL)
+		*produced= 0;
+
+	if((src == NULL  &&  srcLen > 0)  ||  (dst == NULL  &&  dstCap > 0))
+		return UNICODER_NULL_POINTER;
+
+	if(encoding < UNICODER_ASCII  ||  UNICODER_CP1252 < encoding)
+		return UNICODER_ENCODING_UNRECOGNIZED;
+
+	ret= unicoder_folders[encoding - 1](src, srcLen, dst, dstCap, &in, &out);
+
+	if(consumed != NULL)
+		*consumed= in;
+
+	if(produced != NULL)
+		*produced= out;
+
+	return ret;
+}
+
+
+
+
+
+
+/*
+Code point index.
+
+Finding code point n of utf-8 or utf-16 means decoding everything before it. The index does that once
+and keeps the byte offset of every interval-th code point, so a seek is a lookup plus a scan over fewer
+than interval code points, and a slice is at most two of those. At the default interval of 1024 the
+offsets cost 8 bytes per 1024 code points.
+
+Building it is counting: in well formed utf-8 every byte that is not a continuation byte starts a code
+point, and in utf-16 every unit that is not a low surrogate. The vector kernels count those a block at
+a time and skip whole blocks until the next entry falls inside one, which the scalar loop then finds.
+utf-8 is validated first, a block at a time as for the quick check, so the block is still in cache for
+the count; the utf-16 kernels check the surrogate pairs as they go. The fixed width encodings need no
+entries, only checking.
+
+The index never holds the text. An append tells it the text is now longer, wherever it lives by then,
+and only the new bytes are looked at; a code point cut off at the end waits for the next append.
+*/
+
+/* code points between entries when unicoder_index_open is given 0 */
+#define  UNICODER_INDEX_INTERVAL  1024
+
+/* bytes of utf-8 an append validates at a time */
+#define  UNICODER_INDEX_BLOCK  16384
+
+struct unicoder_index
+{
+	unsigned int encoding;
+	size_t interval;
+	size_t* offsets; /* offsets[i] is where code point i * interval starts */
+	size_t count, cap; /* entries in offsets and room for them */
+	size_t codePoints, bytes; /* how much of the text is indexed */
+	int error; /* the bad sequence at bytes, once an append found one */
+};
+
+
+#if defined(UNICODER_AVX2)
+
+/* skips whole 128 byte blocks of utf-8 holding no more than *n lead bytes and takes those off *n, */
+/* returns how many bytes it took care of */
+static UNICODER_TARGET_AVX2 size_t unicoder_avx2_utf8SkipLeads(const unsigned char* p, size_t len, size_t* n)
+{
+	size_t i, leads;
+	__m256i leadCount;
+	const __m256i lastContinuation= _mm256_set1_epi8((char) 0xbf);
+
+	for(i= 0; i + 128 <= len; i += 128)
+	{
+		leadCount= _mm256_cmpgt_epi8(_mm256_loadu_si256((const __m256i*) (p + i)), lastContinuation);
+		leadCount= _mm256_add_epi8(leadCount, _mm256_cmpgt_epi8(_mm256_loadu_si256((const __m256i*) (p + i + 32)), lastContinuation));
+		leadCount= _mm256_add_epi8(leadCount, _mm256_cmpgt_epi8(_mm256_loadu_si256((const __m256i*) (p + i + 64)), lastContinuation));
+		leadCount= _mm256_add_epi8(leadCount, _mm256_cmpgt_epi8(_mm256_loadu_si256((const __m256i*) (p + i + 96)), lastContinuation));
+
+		/* the compares give -1 per lead byte */
+		leads= unicoder_avx2_sumBytes(_mm256_sub_epi8(_mm256_setzero_si256(), leadCount));
+		if(leads > *n)
+			break;
+
+		*n -= leads;
+	}
+
+	return i;
+}
+
+
+/* skips whole 32 byte blocks of utf-16 in endianness that are well formed and hold no more than *n code */
+/* points, takes those off *n; a block ending in a high surrogate is taken without it, returns how many */
+/* bytes it took care of */
+static UNICODER_TARGET_AVX2 size_t unicoder_avx2_utf16Skip(const unsigned char* p, size_t len, unsigned int endianness, size_t* n)
+{
+	size_t i, count;
+	unsigned int high, low, cut;
+	__m256i top;
+	const __m256i surrogateBits= _mm256_set1_epi16(0xfc);
+
+	for(i= 0; i + 32 <= len; i += 32 - 2 * cut)
+	{
+		top= _mm256_loadu_si256((const __m256i*) (p + i));
+		top= (endianness == UNICODER_LES) ? _mm256_srli_epi16(top, 8) : _mm256_and_si256(top, _mm256_set1_epi16(0xff));
+		top= _mm256_and_si256(top, surrogateBits);
+		high= (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi16(top, _mm256_set1_epi16(0xd8)));
+		low= (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi16(top, _mm256_set1_epi16(0xdc)));
+
+		/* two mask bits a unit, every low surrogate has to come right after a high one */
+		if(((high << 2) ^ low) != 0)
+			break;
+
+		cut= high >> 31;
+		count= 16 - cut - ((low == 0) ? 0 : unicoder_bitCount64(low) / 2);
+		if(count > *n)
+			break;
+
+		*n -= count;
+	}
+
+	return i;
+}
+
+#endif
+
+
+#if defined(UNICODER_SSE)
+
+/* skips whole 64 byte blocks of utf-8 holding no more than *n lead bytes and takes those off *n, */
+/* returns how many bytes it took care of */
+static UNICODER_TARGET_SSE size_t unicoder_sse_utf8SkipLeads(const unsigned char* p, size_t len, size_t* n)
+{
+	size_t i, leads;
+	__m128i leadCount;
+	const __m128i lastContinuation= _mm_set1_epi8((char) 0xbf);
+
+	for(i= 0; i + 64 <= len; i += 64)
+	{
+		leadCount= _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*) (p + i)), lastContinuation);
+		leadCount= _mm_add_epi8(leadCount, _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*) (p + i + 16)), lastContinuation));
+		leadCount= _mm_add_epi8(leadCount, _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*) (p + i + 32)), lastContinuation));
+		leadCount= _mm_add_epi8(leadCount, _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*) (p + i + 48)), lastContinuation));
+
+		/* the compares give -1 per lead byte */
+		leads= unicoder_sse_sumBytes(_mm_sub_epi8(_mm_setzero_si128(), leadCount));
+		if(leads > *n)
+			break;
+
+		*n -= leads;
+	}
+
+	return i;
+}
+
+
+/* skips whole 16 byte blocks of utf-16 in endianness that are well formed and hold no more than *n code */
+/* points, takes those off *n; a block ending in a high surrogate is taken without it, returns how many */
+/* bytes it took care of */
+static UNICODER_TARGET_SSE size_t unicoder_sse_utf16Skip(const unsigned char* p, size_t len, unsigned int endianness, size_t* n)
+{
+	size_t i, count;
+	unsigned int high, low, cut;
+	__m128i top;
+	const __m128i surrogateBits= _mm_set1_epi16(0xfc);
+
+	for(i= 0; i + 16 <= len; i += 16 - 2 * cut)
+	{
+		top= _mm_loadu_si128((const __m128i*) (p + i));
+		top= (endianness == UNICODER_LES) ? _mm_srli_epi16(top, 8) : _mm_and_si128(top, _mm_set1_epi16(0xff));
+		top= _mm_and_si128(top, surrogateBits);
+		high= (unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi16(top, _mm_set1_epi16(0xd8)));
+		low= (unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi16(top, _mm_set1_epi16(0xdc)));
+
+		/* two mask bits a unit, every low surrogate has to come right after a high one */
+		if((((high << 2) ^ low) & 0xffff) != 0)
+			break;
+
+		cut= high >> 15;
+		count= 8 - cut - ((low == 0) ? 0 : unicoder_bitCount64(low) / 2);
+		if(count > *n)
+			break;
+
+		*n -= count;
+	}
+
+	return i;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX512)
+
+/* skips whole 64 byte blocks of utf-8 holding no more than *n lead bytes and takes those off *n, */
+/* returns how many bytes it took care of */
+static UNICODER_TARGET_AVX512 size_t unicoder_avx512_utf8SkipLeads(const unsigned char* p, size_t len, size_t* n)
+{
+	size_t i, leads;
+	const __m512i lastContinuation= _mm512_set1_epi8((char) 0xbf);
+
+	for(i= 0; i + 64 <= len; i += 64)
+	{
+		leads= unicoder_bitCount64(_mm512_cmpgt_epi8_mask(_mm512_loadu_si512((const void*) (p + i)), lastContinuation));
+		if(leads > *n)
+			break;
+
+		*n -= leads;
+	}
+
+	return i;
+}
+
+
+/* skips whole 64 byte blocks of utf-16 in endianness that are well formed and hold no more than *n code */
+/* points, takes those off *n; a block ending in a high surrogate is taken without it, returns how many */
+/* bytes it took care of */
+static UNICODER_TARGET_AVX512 size_t unicoder_avx512_utf16Skip(const unsigned char* p, size_t len, unsigned int endianness, size_t* n)
+{
+	size_t i, count;
+	unsigned int high, low, cut;
+	__m512i top;
+	const __m512i surrogateBits= _mm512_set1_epi16(0xfc);
+
+	for(i= 0; i + 64 <= len; i += 64 - 2 * cut)
+	{
+		top= _mm512_loadu_si512((const void*) (p + i));
+		top= (endianness == UNICODER_LES) ? _mm512_srli_epi16(top, 8) : _mm512_and_si512(top, _mm512_set1_epi16(0xff));
+		top= _mm512_and_si512(top, surrogateBits);
+		high= (unsigned int) _mm512_cmpeq_epi16_mask(top, _mm512_set1_epi16(0xd8));
+		low= (unsigned int) _mm512_cmpeq_epi16_mask(top, _mm512_set1_epi16(0xdc));
+
+		/* every low surrogate has to come right after a high one */
+		if(((high << 1) ^ low) != 0)
+			break;
+
+		cut= high >> 31;
+		count= 32 - cut - unicoder_bitCount64(low);
+		if(count > *n)
+			break;
+
+		*n -= count;
+	}
+
+	return i;
+}
+
+#endif
+
+
+/* bytes per code point of the fixed width encodings, 0 for utf-8 and utf-16 */
+static size_t unicoder_index_width(unsigned int encoding)
+{
+	if(encoding == UNICODER_UTF8  ||  encoding == UNICODER_UTF16BE  ||  encoding == UNICODER_UTF16LE)
+		return 0;
+
+	if(encoding == UNICODER_UTF32BE  ||  encoding == UNICODER_UTF32LE)
+		return 4;
+
+	return 1;
+}
+
+
+/* moves over up to *n code points of utf-8 or utf-16 at p (at most len bytes) and takes those it passes */
+/* off *n, passed receives the bytes; utf-8 has to be known to be well formed, utf-16 is checked on the */
+/* way; returns 0 or error code for the sequence it stopped at */
+static int unicoder_index_skip(unsigned int encoding, const unsigned char* p, size_t len, size_t* n, size_t* passed)
+{
+	size_t i= 0;
+	unsigned int x, endianness;
+	int bytesRead;
+	const unicoder_kernelSet* kernels= unicoder_kernels();
+
+	*passed= 0;
+
+	if(encoding == UNICODER_UTF8)
+	{
+		if(kernels->utf8SkipLeads != NULL)
+			i= kernels->utf8SkipLeads(p, len, n);
+
+		/* signed, continuation bytes are the ones from -128 to -65 */
+		for(; i < len; i++)
+		{
+			if((signed char) p[i] > (signed char) 0xbf)
+			{
+				if(*n == 0)
+					break;
+
+				(*n)--;
+			}
+		}
+
+		*passed= i;
+		return 0;
+	}
+
+	endianness= (encoding == UNICODER_UTF16LE) ? UNICODER_LES : UNICODER_BES;
+
+	while(*n > 0  &&  i < len)
+	{
+		if(kernels->utf16Skip != NULL)
+		{
+			i += kernels->utf16Skip(p + i, len - i, endianness, n);
+			if(*n == 0  ||  i == len)
+				break;
+		}
+
+		bytesRead= unicoder_utf16_read(p + i, len - i, &x, endianness);
+		if(bytesRead < 0)
+		{
+			*passed= i;
+			return bytesRead;
+		}
+
+		i += bytesRead;
+		(*n)--;
+	}
+
+	*passed= i;
+	return 0;
+}
+
+
+/* indexes the text from where the index ends up to end, an entry at every interval-th code point */
+/* returns 0 or error code, the index then ending before the offending sequence */
+static int unicoder_index_add(unicoder_index* ix, const unsigned char* text, size_t end)
+{
+	size_t wanted, n, passed, *bigger;
+	int ret= 0;
+
+	while(ret == 0  &&  ix->bytes < end)
+	{
+		/* room first, so running out of memory leaves the index as it was */
+		if(ix->count == ix->cap)
+		{
+			bigger= (size_t*) realloc(ix->offsets, 2 * ix->cap * sizeof(size_t));
+			if(bigger == NULL)
+				return UNICODER_OUT_OF_MEMORY;
+
+			ix->offsets= bigger;
+			ix->cap *= 2;
+		}
+
+		wanted= ix->interval - ix->codePoints % ix->interval;
+		n= wanted;
+		ret= unicoder_index_skip(ix->encoding, text + ix->bytes, end - ix->bytes, &n, &passed);
+
+		ix->bytes += passed;
+		ix->codePoints += wanted - n;
+
+		if(n == 0)
+			ix->offsets[ix->count++]= ix->bytes;
+	}
+
+	return ret;
+}
+
+
+/* opens an empty index for text in encoding, with an entry every interval code points (0 means 1024) */
+/* the index keeps offsets only, the text stays with the caller; returns NULL on failure */
+unicoder_index* unicoder_index_open(unsigned int encoding, size_t interval)
+{
+	unicoder_index* ix;
+
+	if(encoding < UNICODER_ASCII  ||  UNICODER_CP1252 < encoding)
+		return NULL;
+
+	ix= (unicoder_index*) malloc(sizeof(unicoder_index));
+	if(ix == NULL)
+		return NULL;
+
+	ix->cap= 16;
+	ix->offsets= (size_t*) malloc(ix->cap * sizeof(size_t));
+	if(ix->offsets == NULL)
+	{
+		free(ix);
+		return NULL;
+	}
+
+	ix->encoding= encoding;
+	ix->interval= (interval == 0) ? UNICODER_INDEX_INTERVAL : interval;
+	ix->offsets[0]= 0;
+	ix->count= 1;
+	ix->codePoints= 0;
+	ix->bytes= 0;
+	ix->error= 0;
+
+	return ix;
+}
+
+
+/* brings the index up to the first len bytes of text, which has to start with the bytes indexed so far */
+/* (text may have moved since); a code point cut off at the end is left for the next append */
+/* returns 0 or error code, the index then covering what comes before the offending sequence */
+int unicoder_index_append(unicoder_index* ix, const unsigned char* text, size_t len)
+{
+	size_t width, end, valid, i;
+	unsigned int x;
+	int ret, added;
+
+	if(ix == NULL  ||  (text == NULL  &&  len > 0))
+		return UNICODER_NULL_POINTER;
+
+	if(len < ix->bytes)
+		return UNICODER_BAD_LENGTH;
+
+	if(ix->error != 0)
+		return ix->error;
+
+	width= unicoder_index_width(ix->encoding);
+	ret= 0;
+
+	/* no entries, only the bytes to check */
+	if(width != 0)
+	{
+		end= ix->bytes;
+
+		if(ix->encoding == UNICODER_ASCII)
+		{
+			end += unicoder_skipBelow(text + end, len - end, 0x80);
+			if(end < len)
+				ret= UNICODER_INVALID_BYTE_SEQUENCE;
+		}
+
+		else if(width == 4)
+		{
+			for(; end + 4 <= len; end += 4)
+			{
+				ret= unicoder_readStep(text + end, 4, &x, ix->encoding);
+				if(ret < 0)
+					break;
+			}
+
+			ret= (ret < 0) ? ret : 0;
+		}
+
+		/* every byte is a character of the code pages */
+		else
+			end= len;
+
+		ix->bytes= end;
+		ix->codePoints= end / width;
+	}
+
+	else if(ix->encoding == UNICODER_UTF8)
+	{
+		while(ret == 0  &&  ix->bytes < len)
+		{
+			end= (len - ix->bytes > UNICODER_INDEX_BLOCK) ? ix->bytes + UNICODER_INDEX_BLOCK : len;
+			for(i= 0; i < 3  &&  end < len  &&  (text[end] & 0xc0) == 0x80; i++)
+				end--;
+
+			/* a bad block is validated again to the end of text, for where the first bad sequence */
+			/* really is; the index stops there */
+			if(unicoder_utf8_validate(text + ix->bytes, end - ix->bytes, NULL) < 0)
+			{
+				ret= unicoder_utf8_validate(text + ix->bytes, len - ix->bytes, &valid);
+				end= ix->bytes + valid;
+			}
+
+			added= unicoder_index_add(ix, text, end);
+			if(added != 0)
+				return added;
+		}
+	}
+
+	else
+		ret= unicoder_index_add(ix, text, len);
+
+	if(ret == UNICODER_INCOMPLETE_SEQUENCE)
+		return 0;
+
+	if(ret != UNICODER_OUT_OF_MEMORY)
+		ix->error= ret;
+
+	return ret;
+}
+
+
+/* code points and bytes of text the index covers (either may be NULL) */
+void unicoder_index_length(const unicoder_index* ix, size_t* codePoints, size_t* bytes)
+{
+	if(codePoints != NULL)
+		*codePoints= (ix == NULL) ? 0 : ix->codePoints;
+
+	if(bytes != NULL)
+		*bytes= (ix == NULL) ? 0 : ix->bytes;
+}
+
+
+/* offset of code point n, starting the scan at code point from (offset fromOffset) when that is closer */
+/* than the entry before n */
+static int unicoder_index_find(const unicoder_index* ix, const unsigned char* text, size_t n,
+                               size_t from, size_t fromOffset, size_t* offset)
+{
+	size_t width, entry, rest, passed;
+	int ret;
+
+	if(n > ix->codePoints)
+		return UNICODER_EOF;
+
+	width= unicoder_index_width(ix->encoding);
+	if(width != 0)
+	{
+		*offset= n * width;
+		return 0;
+	}
+
+	entry= n / ix->interval;
+	if(entry * ix->interval > from  ||  from > n)
+	{
+		from= entry * ix->interval;
+		fromOffset= ix->offsets[entry];
+	}
+
+	rest= n - from;
+	ret= unicoder_index_skip(ix->encoding, text + fromOffset, ix->bytes - fromOffset, &rest, &passed);
+	*offset= fromOffset + passed;
+
+	return ret;
+}
+
+
+/* byte offset in text of code point n, where n may be the number of code points indexed for the end */
+/* scans fewer than interval code points; returns 0, UNICODER_EOF if n is past the end, or error code */
+int unicoder_index_seek(const unicoder_index* ix, const unsigned char* text, size_t n, size_t* offset)
+{
+	if(ix == NULL  ||  text == NULL  ||  offset == NULL)
+		return UNICODER_NULL_POINTER;
+
+	return unicoder_index_find(ix, text, n, 0, 0, offset);
+}
+
+
+/* bytes [start, end) of text holding code points first up to but not including last, no copying */
+/* returns 0, UNICODER_EOF if last is past the end, UNICODER_BAD_LENGTH if first is past last, or error code */
+int unicoder_index_slice(const unicoder_index* ix, const unsigned char* text, size_t first, size_t last,
+                         size_t* start, size_t* end)
+{
+	int ret;
+
+	if(ix == NULL  ||  text == NULL  ||  start == NULL  ||  end == NULL)
+		return UNICODER_NULL_POINTER;
+
+	if(first > last)
+		return UNICODER_BAD_LENGTH;
+
+	ret= unicoder_index_find(ix, text, first, 0, 0, start);
+	if(ret != 0)
+		return ret;
+
+	return unicoder_index_find(ix, text, last, first, *start, end);
+}
+
+
+/* frees the index, not the text */
+void unicoder_index_close(unicoder_index* ix)
+{
+	if(ix == NULL)
+		return;
+
+	free(ix->offsets);
+	free(ix);
+}
+
+
+
+
+
+
+/*
+Record splitting.
+
+Splits text into records at a delimiter, LF or LF with an optional CR before it (UNICODER_LINES) or any
+other code point, and hands out each record as a span of the text itself. The delimiter is encoded
+once and looked for a whole code unit at a time, at multiples of the unit size from the start of the
+text, so 0A inside a utf-16 or utf-32 unit is never taken for a line feed. A code unit that equals the
+delimiter's first one always starts a code point in well formed text: utf-8 lead bytes never turn up
+as continuation bytes, and a utf-16 unit other than a surrogate is a code point of its own. So the
+vector kernels compare a block of utf-16 or utf-32 units at a time, memchr does the same for bytes,
+and only a hit is looked at more closely.
+
+Records are not checked, a bad sequence just ends up in one of them. unicoder_reader_readRecord runs
+the same search over the reader's buffer and hands out spans of it, growing the buffer for a record
+that does not fit.
+*/
+
+#if defined(UNICODER_AVX2)
+
+/* looks for unit (unitSize 2 or 4 bytes) at multiples of unitSize in whole 32 byte blocks */
+/* returns the offset of the first one or, if no block has one, how many bytes it took care of */
+static UNICODER_TARGET_AVX2 size_t unicoder_avx2_findUnit(const unsigned char* p, size_t len, const unsigned char* unit, unsigned int unitSize)
+{
+	size_t i;
+	unsigned int found;
+	unsigned short u16;
+	unsigned int u32;
+	__m256i in, needle;
+
+	memcpy(&u16, unit, 2);
+	memcpy(&u32, unit, 4);
+	needle= (unitSize == 2) ? _mm256_set1_epi16((short) u16) : _mm256_set1_epi32((int) u32);
+
+	for(i= 0; i + 32 <= len; i += 32)
+	{
+		in= _mm256_loadu_si256((const __m256i*) (p + i));
+		in= (unitSize == 2) ? _mm256_cmpeq_epi16(in, needle) : _mm256_cmpeq_epi32(in, needle);
+
+		found= (unsigned int) _mm256_movemask_epi8(in);
+		if(found != 0)
+			return i + unicoder_lowestBit64(found);
+	}
+
+	return i;
+}
+
+#endif
+
+
+#if defined(UNICODER_SSE)
+
+/* looks for unit (unitSize 2 or 4 bytes) at multiples of unitSize in whole 16 byte blocks */
+/* returns the offset of the first one or, if no block has one, how many bytes it took care of */
+static UNICODER_TARGET_SSE size_t unicoder_sse_findUnit(const unsigned char* p, size_t len, const unsigned char* unit, unsigned int unitSize)
+{
+	size_t i;
+	unsigned int found;
+	unsigned short u16;
+	unsigned int u32;
+	__m128i in, needle;
+
+	memcpy(&u16, unit, 2);
+	memcpy(&u32, unit, 4);
+	needle= (unitSize == 2) ? _mm_set1_epi16((short) u16) : _mm_set1_epi32((int) u32);
+
+	for(i= 0; i + 16 <= len; i += 16)
+	{
+		in= _mm_loadu_si128((const __m128i*) (p + i));
+		in= (unitSize == 2) ? _mm_cmpeq_epi16(in, needle) : _mm_cmpeq_epi32(in, needle);
+
+		found= (unsigned int) _mm_movemask_epi8(in);
+		if(found != 0)
+			return i + unicoder_lowestBit64(found);
+	}
+
+	return i;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX512)
+
+/* looks for unit (unitSize 2 or 4 bytes) at multiples of unitSize in whole 64 byte blocks */
+/* returns the offset of the first one or, if no block has one, how many bytes it took care of */
+static UNICODER_TARGET_AVX512 size_t unicoder_avx512_findUnit(const unsigned char* p, size_t len, const unsigned char* unit, unsigned int unitSize)
+{
+	size_t i;
+	unsigned long long found;
+	unsigned short u16;
+	unsigned int u32;
+	__m512i in, needle;
+
+	memcpy(&u16, unit, 2);
+	memcpy(&u32, unit, 4);
+	needle= (unitSize == 2) ? _mm512_set1_epi16((short) u16) : _mm512_set1_epi32((int) u32);
+
+	for(i= 0; i + 64 <= len; i += 64)
+	{
+		in= _mm512_loadu_si512((const void*) (p + i));
+		found= (unitSize == 2) ? _mm512_cmpeq_epi16_mask(in, needle) : _mm512_cmpeq_epi32_mask(in, needle);
+
+		/* one mask bit a unit */
+		if(found != 0)
+			return i + unitSize * unicoder_lowestBit64(found);
+	}
+
+	return i;
+}
+
+#endif
+
+
+/* sets up s to split len bytes of text in encoding into records ending in delimiter, a code point or */
+/* UNICODER_LINES for LF with an optional CR before it; returns 0 or error code, for one if delimiter */
+/* cannot be written in encoding */
+int unicoder_splitter_init(unicoder_splitter* s, const unsigned char* text, size_t len, unsigned int encoding, unsigned int delimiter)
+{
+	int bytesWritten;
+
+	if(s == NULL  ||  (text == NULL  &&  len > 0))
+		return UNICODER_NULL_POINTER;
+
+	if(encoding < UNICODER_ASCII  ||  UNICODER_CP1252 < encoding)
+		return UNICODER_ENCODING_UNRECOGNIZED;
+
+	s->text= text;
+	s->len= len;
+	s->next= 0;
+	s->unitSize= (encoding == UNICODER_UTF16BE  ||  encoding == UNICODER_UTF16LE) ? 2
+	           : (encoding == UNICODER_UTF32BE  ||  encoding == UNICODER_UTF32LE) ? 4 : 1;
+	s->carriageReturnLen= 0;
+
+	bytesWritten= unicoder_writeStep(s->delimiter, 4, (delimiter == UNICODER_LINES) ? 0x0a : delimiter, encoding);
+	if(bytesWritten < 0)
+		return bytesWritten;
+
+	s->delimiterLen= (unsigned int) bytesWritten;
+
+	/* every encoding has LF, so it has CR */
+	if(delimiter == UNICODER_LINES)
+		s->carriageReturnLen= (unsigned int) unicoder_writeStep(s->carriageReturn, 4, 0x0d, encoding);
+
+	return 0;
+}
+
+
+/* finds the delimiter at or after from, a multiple of the unit size; returns 1 with its offset in at, */
+/* or 0 with at where the search can pick up again once the text is longer */
+static int unicoder_splitter_find(const unicoder_splitter* s, size_t from, size_t* at)
+{
+	size_t i= from;
+	const unsigned char* hit;
+	size_t (*kernel)(const unsigned char*, size_t, const unsigned char*, unsigned int)= unicoder_kernels()->findUnit;
+
+	while(i + s->unitSize <= s->len)
+	{
+		/* memchr is the byte kernel the C library already has */
+		if(s->unitSize == 1)
+		{
+			hit= (const unsigned char*) memchr(s->text + i, s->delimiter[0], s->len - i);
+			i= (hit == NULL) ? s->len : (size_t) (hit - s->text);
+		}
+
+		else
+		{
+			if(kernel != NULL)
+				i += kernel(s->text + i, s->len - i, s->delimiter, s->unitSize);
+
+			while(i + s->unitSize <= s->len  &&  memcmp(s->text + i, s->delimiter, s->unitSize) != 0)
+				i += s->unitSize;
+		}
+
+		if(i + s->unitSize > s->len)
+			break;
+
+		/* the rest of a longer delimiter may still be on its way */
+		if(i + s->delimiterLen > s->len)
+		{
+			*at= i;
+			return 0;
+		}
+
+		if(memcmp(s->text + i, s->delimiter, s->delimiterLen) == 0)
+		{
+			*at= i;
+			return 1;
+		}
+
+		i += s->unitSize;
+	}
+
+	*at= i;
+	return 0;
+}
+
+
+/* length of the record from start to the delimiter at at, less a CR right before it for UNICODER_LINES */
+static size_t unicoder_splitter_recordLen(const unicoder_splitter* s, size_t start, size_t at)
+{
+	size_t cr= s->carriageReturnLen;
+
+	if(cr != 0  &&  at - start >= cr  &&  memcmp(s->text + at - cr, s->carriageReturn, cr) == 0)
+		return at - start - cr;
+
+	return at - start;
+}
+
+
+/* points record at the next record of the text and stores its length in bytes, without the delimiter, */
+/* in recordLen; the record is part of the text, nothing is copied; text that ends in a delimiter has no */
+/* empty record after it; returns 0, UNICODER_EOF when there are no more records or error code */
+int unicoder_splitter_next(unicoder_splitter* s, const unsigned char** record, size_t* recordLen)
+{
+	size_t at;
+
+	if(s == NULL  ||  record == NULL  ||  recordLen == NULL)
+		return UNICODER_NULL_POINTER;
+
+	if(s->next >= s->len)
+		return UNICODER_EOF;
+
+	*record= s->text + s->next;
+
+	if(unicoder_splitter_find(s, s->next, &at))
+	{
+		*recordLen= unicoder_splitter_recordLen(s, s->next, at);
+		s->next= at + s->delimiterLen;
+	}
+
+	else
+	{
+		*recordLen= s->len - s->next;
+		s->next= s->len;
+	}
+
+	return 0;
+}
+
+
+/* reads the next record of the stream, up to delimiter as for unicoder_splitter_init, pointing record */
+/* at it in the reader's buffer (valid until the next call on r) and storing its length in recordLen */
+/* returns 0, UNICODER_EOF at the end or error code */
+int unicoder_reader_readRecord(unicoder_reader* r, unsigned int delimiter, const unsigned char** record, size_t* recordLen)
+{
+	unicoder_splitter s;
+	size_t from= 0, at;
+	unsigned char* bigger;
+	int ret, found;
+
+	if(r == NULL  ||  record == NULL  ||  recordLen == NULL)
+		return UNICODER_NULL_POINTER;
+
+	for(;;)
+	{
+		ret= unicoder_splitter_init(&s, r->buf + r->start, r->end - r->start, r->encoding, delimiter);
+		if(ret != 0)
+			return ret;
+
+		found= unicoder_splitter_find(&s, from, &at);
+		if(found  ||  r->eof)
+			break;
+
+		/* the record goes on past the buffer, which refill moves it to the front of; a record as */
+		/* long as the whole buffer gets a bigger one */
+		if(r->start == 0  &&  r->end == r->cap)
+		{
+			bigger= (unsigned char*) realloc(r->buf, 2 * r->cap);
+			if(bigger == NULL)
+				return UNICODER_OUT_OF_MEMORY;
+
+			r->buf= bigger;
+			r->cap *= 2;
+		}
+
+		from= at;
+		ret= unicoder_reader_refill(r);
+		if(ret != 0)
+			return ret;
+	}
+
+	if(r->start == r->end)
+		return UNICODER_EOF;
+
+	*record= r->buf + r->start;
+
+	if(found)
+	{
+		*recordLen= unicoder_splitter_recordLen(&s, 0, at);
+		r->start += at + s.delimiterLen;
+	}
+
+	else
+	{
+		*recordLen= r->end - r->start;
+		r->start= r->end;
+	}
+
+	return 0;
+}
+
+
+
+
+
+
+/*
+Encoding detection.
+
+Without a byte order mark the encoding is guessed from a sample at the start of the buffer. Text in
+utf-16 and utf-32 is full of zero bytes, and where they fall tells the width and byte order apart:
+latin text in utf-16le has them in the odd bytes, utf-32le in the top two bytes of every unit, and
+so on. Zero bytes are counted by position mod 4 with byte wide vector counters. With no zeros to go
+on, utf-8 validity tells utf-8 from ascii, and for the rest (cjk utf-16 has few zeros) the one byte
+order the sample is valid in, if there is just one. 8 bit text that is not utf-8 is taken for
+windows-1252, which reads every byte and agrees with ISO-8859-1 outside 80..9F: right away when it
+is nearly all ascii, as western text is and utf-16 is not, otherwise only when utf-16 does not fit.
+*/
+
+#define  UNICODER_DETECT_SAMPLE  4096
+
+#if defined(UNICODER_AVX2)
+
+/* adds up zero bytes by position mod 4 in the first multiple of 32 bytes, returns how many bytes it looked at */
+static UNICODER_TARGET_AVX2 size_t unicoder_avx2_countZeros(const unsigned char* p, size_t len, size_t zeros[4])
+{
+	size_t i= 0, end, j;
+	unsigned char counts[32];
+	__m256i zeroCount;
+
+	while(i + 32 <= len)
+	{
+		/* the byte counters hold up to 255 before they have to be summed */
+		zeroCount= _mm256_setzero_si256();
+		end= (len - i > 255 * 32) ? i + 255 * 32 : len;
+
+		for(; i + 32 <= end; i += 32)
+			zeroCount= _mm256_sub_epi8(zeroCount, _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) (p + i)),
+			                                                        _mm256_setzero_si256()));
+
+		_mm256_storeu_si256((__m256i*) counts, zeroCount);
+		for(j= 0; j < 32; j++)
+			zeros[j & 3] += counts[j];
+	}
+
+	return i;
+}
+
+#endif
+
+
+#if defined(UNICODER_SSE)
+
+/* adds up zero bytes by position mod 4 in the first multiple of 16 bytes, returns how many bytes it looked at */
+static UNICODER_TARGET_SSE size_t unicoder_sse_countZeros(const unsigned char* p, size_t len, size_t zeros[4])
+{
+	size_t i= 0, end, j;
+	unsigned char counts[16];
+	__m128i zeroCount;
+
+	while(i + 16 <= len)
+	{
+		/* the byte counters hold up to 255 before they have to be summed */
+		zeroCount= _mm_setzero_si128();
+		end= (len - i > 255 * 16) ? i + 255 * 16 : len;
+
+		for(; i + 16 <= end; i += 16)
+			zeroCount= _mm_sub_epi8(zeroCount, _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) (p + i)),
+			                                                  _mm_setzero_si128()));
+
+		_mm_storeu_si128((__m128i*) counts, zeroCount);
+		for(j= 0; j < 16; j++)
+			zeros[j & 3] += counts[j];
+	}
+
+	return i;
+}
+
+#endif
+
+
+#if defined(UNICODER_AVX512)
+
+/* adds up zero bytes by position mod 4 from every fourth bit of the compare masks, returns len */
+static UNICODER_TARGET_AVX512 size_t unicoder_avx512_countZeros(const unsigned char* p, size_t len, size_t zeros[4])
+{
+	size_t i;
+	unsigned int j;
+	__m512i in;
+	__mmask64 zero, tail;
+
+	for(i= 0; i + 64 <= len; i += 64)
+	{
+		in= _mm512_loadu_si512((const void*) (p + i));
+		zero= _mm512_testn_epi8_mask(in, in);
+		for(j= 0; j < 4; j++)
+			zeros[j] += unicoder_bitCount64(zero & (0x1111111111111111ull << j));
+	}
+
+	if(i < len)
+	{
+		tail= ((__mmask64) 1 << (len - i)) - 1;
+		in= _mm512_maskz_loadu_epi8(tail, p + i);
+		zero= _mm512_mask_testn_epi8_mask(tail, in, in);
+		for(j= 0; j < 4; j++)
+			zeros[j] += unicoder_bitCount64(zero & (0x1111111111111111ull << j));
+	}
+
+	return len;
+}
+
+#endif
+
+
+static void unicoder_countZeros(const unsigned char* p, size_t len, size_t zeros[4])
+{
+	size_t i= 0;
+
+	zeros[0]= zeros[1]= zeros[2]= zeros[3]= 0;
+
+	if(unicoder_kernels()->countZeros != NULL)
+		i= unicoder_kernels()->countZeros(p, len, zeros);
+
+	for(; i < len; i++)
+		zeros[i & 3] += (p[i] == 0);
+}
+
+
+/* whether len bytes hold nothing but well formed code points in encoding, a sequence cut off by the end is allowed */
+static int unicoder_sampleIsValid(const unsigned char* p, size_t len, unsigned int encoding)
+{
+	size_t i= 0;
+	unsigned int x;
+	int bytesRead;
+
+	while(i < len)
+	{
+		bytesRead= unicoder_readStep(p + i, len - i, &x, encoding);
+		if(bytesRead == UNICODER_INCOMPLETE_SEQUENCE)
+			return 1;
+		if(bytesRead < 0)
+			return 0;
+		i += bytesRead;
+	}
+
+	return 1;
+}
+
+
+/* number of different byte values in the even and in the odd positions of len bytes at p */
+static void unicoder_countDistinct(const unsigned char* p, size_t len, size_t* even, size_t* odd)
+{
+	unsigned char seen[2][256];
+	size_t i;
+
+	memset(seen, 0, sizeof(seen));
+	*even= 0;
+	*odd= 0;
+
+	for(i= 0; i < len; i++)
+	{
+		if(!seen[i & 1][p[i]])
+		{
+			seen[i & 1][p[i]]= 1;
+			if(i & 1)
+				(*odd)++;
+			else
+				(*even)++;
+		}
+	}
+}
+
+
+/* guesses the encoding of len bytes at buf from the first sampleLen of them (0 means 4096) */
+/* a byte order mark decides it outright; confidence (may be NULL) receives 0 to 100 for how sure the guess is */
+/* 8 bit text that is not utf-8 comes back as UNICODER_CP1252; returns an encoding, UNICODER_ASCII */
+/* with confidence 0 when nothing fits, or error code */
+int unicoder_detectEncoding(const unsigned char* buf, size_t len, size_t sampleLen, unsigned int* confidence)
+{
+	size_t zeros[4], n, units, odd, even, oddValues, evenValues, valid, leads, longLeads, ascii, i;
+	unsigned int sure= 0;
+	int encoding, validLe, validBe, ret;
+
+	if(confidence != NULL)
+		*confidence= 0;
+
+	if(buf == NULL  &&  len > 0)
+		return UNICODER_NULL_POINTER;
+
+	/* a mark of 4 bytes only counts when there are 4 bytes to hold it */
+	encoding= (len > 0) ? (int) unicoder_bomEncoding(buf, len, NULL) : 0;
+	if(encoding != 0)
+	{
+		if(confidence != NULL)
+			*confidence= 100;
+		return encoding;
+	}
+
+	if(sampleLen == 0)
+		sampleLen= UNICODER_DETECT_SAMPLE;
+
+	n= (len < sampleLen) ? len : sampleLen;
+	if(n == 0)
+		return UNICODER_ASCII;
+
+	unicoder_countZeros(buf, n, zeros);
+	units= n / 4;
+	odd= zeros[1] + zeros[3];
+	even= zeros[0] + zeros[2];
+
+	/* utf-32: one end of every unit is zero, and the byte next to it nearly always is */
+	if(units > 0  &&  zeros[3] >= units  &&  zeros[2] >= units / 2  &&  zeros[0] < units / 2)
+	{
+		encoding= UNICODER_UTF32LE;
+		sure= unicoder_sampleIsValid(buf, n, encoding) ? ((units >= 16) ? 95 : 60) : 0;
+	}
+
+	else if(units > 0  &&  zeros[0] >= units  &&  zeros[1] >= units / 2  &&  zeros[3] < units / 2)
+	{
+		encoding= UNICODER_UTF32BE;
+		sure= unicoder_sampleIsValid(buf, n, encoding) ? ((units >= 16) ? 95 : 60) : 0;
+	}
+
+	/* utf-16: zeros pile up on one side, how lopsided says how sure, and a short sample is never */
+	/* more than a fair guess, as for utf-32 */
+	else if(n >= 2  &&  odd > 0  &&  odd >= 8 * even  &&  odd * 8 >= n / 2)
+	{
+		encoding= UNICODER_UTF16LE;
+		sure= unicoder_sampleIsValid(buf, n, encoding) ? 50 + (unsigned int) (50 * (odd - even) / (n / 2 + 1)) : 0;
+		if(n / 2 < 16  &&  sure > 60)
+			sure= 60;
+	}
+
+	else if(n >= 2  &&  even > 0  &&  even >= 8 * odd  &&  even * 8 >= n / 2)
+	{
+		encoding= UNICODER_UTF16BE;
+		sure= unicoder_sampleIsValid(buf, n, encoding) ? 50 + (unsigned int) (50 * (even - odd) / (n / 2 + 1)) : 0;
+		if(n / 2 < 16  &&  sure > 60)
+			sure= 60;
+	}
+
+	if(sure > 0)
+	{
+		if(confidence != NULL)
+			*confidence= (sure > 99) ? 99 : sure;
+		return encoding;
+	}
+
+	/* 8 bit text has no business holding zero bytes */
+	if(even + odd == 0)
+	{
+		ret= unicoder_utf8_validate(buf, n, &valid);
+
+		/* the sample may cut the last code point in half */
+		if(ret == 0  ||  (ret == UNICODER_INCOMPLETE_SEQUENCE  &&  n < len))
+		{
+			unicoder_utf8_countLeads(buf, valid, &leads, &longLeads);
+
+			/* a cut off lead byte is not ascii, even after nothing but ascii */
+			if(leads == valid  &&  valid == n)
+			{
+				encoding= UNICODER_ASCII;
+				sure= 80;
+			}
+
+			else
+			{
+				encoding= UNICODER_UTF8;
+				sure= (valid - leads >= 8) ? 95 : 70;
+			}
+
+			if(confidence != NULL)
+				*confidence= sure;
+			return encoding;
+		}
+
+		for(i= 0, ascii= 0; i < n; i++)
+			ascii += (buf[i] < 0x80);
+
+		if(ascii >= n - n / 8)
+		{
+			if(confidence != NULL)
+				*confidence= 60;
+			return UNICODER_CP1252;
+		}
+	}
+
+	/* no zeros to go on, as in cjk utf-16; take a byte order if it is the only one that works */
+	if(n >= 2)
+	{
+		n &= ~(size_t) 1;
+		validLe= unicoder_sampleIsValid(buf, n, UNICODER_UTF16LE);
+		validBe= unicoder_sampleIsValid(buf, n, UNICODER_UTF16BE);
+
+		if(validLe != validBe)
+		{
+			if(confidence != NULL)
+				*confidence= 30;
+			return validLe ? UNICODER_UTF16LE : UNICODER_UTF16BE;
+		}
+
+		/* both work, so go by which side looks like high bytes: a script sits in a few of them */
+		if(validLe)
+		{
+			/* even and odd still count zero bytes, the windows-1252 fallback below needs them */
+			unicoder_countDistinct(buf, n, &evenValues, &oddValues);
+
+			if(2 * oddValues <= evenValues  ||  2 * evenValues <= oddValues)
+			{
+				if(confidence != NULL)
+					*confidence= 20;
+				return (oddValues < evenValues) ? UNICODER_UTF16LE : UNICODER_UTF16BE;
+			}
+		}
+	}
+
+	if(even + odd == 0)
+	{
+		if(confidence != NULL)
+			*confidence= 10;
+		return UNICODER_CP1252;
+	}
+
+	return UNICODER_ASCII;
+}
+
+
+/* same as unicoder_detectEncoding for the start of file f, leaves the file position where it was */
+int unicoder_detectEncodingFromFile(FILE* f, size_t sampleLen, unsigned int* confidence)
+{
+	unsigned char* sample;
+	long originalPosition;
+	size_t got;
+	int encoding;
+
+	if(confidence != NULL)
+		*confidence= 0;
+
+	if(f == NULL)
+		return UNICODER_FILE_IO_ERROR;
+
+	/* a byte order mark is the cheap answer */
+	encoding= unicoder_decodeBomFromFile(f);
+	if(encoding != UNICODER_ASCII)
+	{
+		if(confidence != NULL  &&  encoding > 0)
+			*confidence= 100;
+		return encoding;
+	}
+
+	if(sampleLen == 0)
+		sampleLen= UNICODER_DETECT_SAMPLE;
+
+	sample= (unsigned char*) malloc(sampleLen);
+	if(sample == NULL)
+		return UNICODER_OUT_OF_MEMORY;
+
+	originalPosition= ftell(f);
+	fseek(f, 0, SEEK_SET);
+	got= fread(sample, 1, sampleLen, f);
+	fseek(f, originalPosition, SEEK_SET);
+
+	/* reading fewer bytes than asked means the whole file is in the sample */
+	encoding= unicoder_detectEncoding(sample, got, got, confidence);
+
+	free(sample);
+	return encoding;
+}
+
+
+
+
+
+
+/*
+CPU dispatch.
+
+Validation, the pairs with vector kernels, counting and swapping go through a kernel set bound once
+per process, the first time one of them runs: the widest tier the cpu has among those compiled in.
+__builtin_cpu_supports reads cpuid (and whether the os saves the wide registers) for that. Setting
+UNICODER_CPU to scalar, sse4.1, avx2 or avx512 in the environment, or calling unicoder_setCpuTier,
+picks a narrower tier, to compare them or to stay off a bad one; neither goes past what the cpu has.
+The first-use binding only ever replaces nothing, so a tier set by another thread in the meantime is
+kept rather than overwritten with the detected one. A NULL kernel leaves that job to the scalar loop
+next to the call.
+*/
+
+#if defined(__GNUC__)
+#define  UNICODER_LOAD_ACQUIRE(p)      __atomic_load_n(&(p), __ATOMIC_ACQUIRE)
+#define  UNICODER_STORE_RELEASE(p, x)  __atomic_store_n(&(p), (x), __ATOMIC_RELEASE)
+/* stores x if p still holds expected, otherwise loads p into expected; true if it stored */
+#define  UNICODER_SWAP_RELEASE(p, expected, x)  \
+	__atomic_compare_exchange_n(&(p), &(expected), (x), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#else
+#define  UNICODER_LOAD_ACQUIRE(p)      (p)
+#define  UNICODER_STORE_RELEASE(p, x)  ((p)= (x))
+#define  UNICODER_SWAP_RELEASE(p, expected, x)  \
+	(((p) == (expected)) ? ((p)= (x), 1) : ((expected)= (p), 0))
+#endif
+
+static const unicoder_kernelSet unicoder_scalarKernels=
+{
+	UNICODER_CPU_SCALAR,
+	unicoder_scalar_utf8FindErrorBlock,
+	unicoder_scalar_transcode_utf8_utf16be,    unicoder_scalar_transcode_utf8_utf16le,
+	unicoder_scalar_transcode_utf16be_utf8,    unicoder_scalar_transcode_utf16le_utf8,
+	unicoder_scalar_transcode_utf16be_utf16le, unicoder_scalar_transcode_utf16le_utf16be,
+	unicoder_scalar_transcode_utf32be_utf32le, unicoder_scalar_transcode_utf32le_utf32be,
+	unicoder_scalar_transcode_utf16be_utf16be, unicoder_scalar_transcode_utf16le_utf16le,
+	unicoder_scalar_transcode_utf32be_utf32be, unicoder_scalar_transcode_utf32le_utf32le,
+	unicoder_scalar_transcode_iso8859_1_utf8,  unicoder_scalar_transcode_utf8_iso8859_1,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL
+};
+
+#if defined(UNICODER_SSE)
+static const unicoder_kernelSet unicoder_sseKernels=
+{
+	UNICODER_CPU_SSE41,
+	unicoder_sse_utf8FindErrorBlock,
+	unicoder_sse_transcode_utf8_utf16be,    unicoder_sse_transcode_utf8_utf16le,
+	unicoder_sse_transcode_utf16be_utf8,    unicoder_sse_transcode_utf16le_utf8,
+	unicoder_sse_transcode_utf16be_utf16le, unicoder_sse_transcode_utf16le_utf16be,
+	unicoder_sse_transcode_utf32be_utf32le, unicoder_sse_transcode_utf32le_utf32be,
+	unicoder_sse_transcode_utf16be_utf16be, unicoder_sse_transcode_utf16le_utf16le,
+	unicoder_sse_transcode_utf32be_utf32be, unicoder_sse_transcode_utf32le_utf32le,
+	unicoder_sse_transcode_iso8859_1_utf8,  unicoder_sse_transcode_utf8_iso8859_1,
+	unicoder_sse_utf8CountLeads,
+	unicoder_sse_countZeros,
+	unicoder_sse_swapBytes,
+	unicoder_sse_skipBelow,
+	unicoder_sse_asciiFold,
+	unicoder_sse_utf8Fold,
+	unicoder_sse_utf8SkipLeads,
+	unicoder_sse_utf16Skip,
+	unicoder_sse_findUnit
+};
+#endif
+
+#if defined(UNICODER_AVX2)
+static const unicoder_kernelSet unicoder_avx2Kernels=
+{
+	UNICODER_CPU_AVX2,
+	unicoder_avx2_utf8FindErrorBlock,
+	unicoder_avx2_transcode_utf8_utf16be,    unicoder_avx2_transcode_utf8_utf16le,
+	unicoder_avx2_transcode_utf16be_utf8,    unicoder_avx2_transcode_utf16le_utf8,
+	unicoder_avx2_transcode_utf16be_utf16le, unicoder_avx2_transcode_utf16le_utf16be,
+	unicoder_avx2_transcode_utf32be_utf32le, unicoder_avx2_transcode_utf32le_utf32be,
+	unicoder_avx2_transcode_utf16be_utf16be, unicoder_avx2_transcode_utf16le_utf16le,
+	unicoder_avx2_transcode_utf32be_utf32be, unicoder_avx2_transcode_utf32le_utf32le,
+	unicoder_avx2_transcode_iso8859_1_utf8,  unicoder_avx2_transcode_utf8_iso8859_1,
+	unicoder_avx2_utf8CountLeads,
+	unicoder_avx2_countZeros,
+	unicoder_avx2_swapBytes,
+	unicoder_avx2_skipBelow,
+	unicoder_avx2_asciiFold,
+	unicoder_avx2_utf8Fold,
+	unicoder_avx2_utf8SkipLeads,
+	unicoder_avx2_utf16Skip,
+	unicoder_avx2_findUnit
+};
+#endif
+
+#if defined(UNICODER_AVX512)
+static const unicoder_kernelSet unicoder_avx512Kernels=
+{
+	UNICODER_CPU_AVX512,
+	unicoder_avx512_utf8FindErrorBlock,
+	unicoder_avx512_transcode_utf8_utf16be,    unicoder_avx512_transcode_utf8_utf16le,
+	unicoder_avx512_transcode_utf16be_utf8,    unicoder_avx512_transcode_utf16le_utf8,
+	unicoder_avx512_transcode_utf16be_utf16le, unicoder_avx512_transcode_utf16le_utf16be,
+	unicoder_avx512_transcode_utf32be_utf32le, unicoder_avx512_transcode_utf32le_utf32be,
+	unicoder_avx512_transcode_utf16be_utf16be, unicoder_avx512_transcode_utf16le_utf16le,
+	unicoder_avx512_transcode_utf32be_utf32be, unicoder_avx512_transcode_utf32le_utf32le,
+	unicoder_avx512_transcode_iso8859_1_utf8,  unicoder_avx512_transcode_utf8_iso8859_1,
+	unicoder_avx512_utf8CountLeads,
+	unicoder_avx512_countZeros,
+	unicoder_avx512_swapBytes,
+	unicoder_avx512_skipBelow,
+	unicoder_avx512_asciiFold,
+	unicoder_avx512_utf8Fold,
+	unicoder_avx512_utf8SkipLeads,
+	unicoder_avx512_utf16Skip,
+	unicoder_avx512_findUnit
+};
+#endif
+
+static const unicoder_kernelSet* unicoder_kernelsBound= NULL;
+
+
+/* the widest tier both this cpu and this build have */
+static unsigned int unicoder_cpuSupported(void)
+{
+	unsigned int tier= UNICODER_CPU_SCALAR;
+
+#if defined(UNICODER_DISPATCH)
+	__builtin_cpu_init();
+
+	if(__builtin_cpu_supports("sse4.1"))
+		tier= UNICODER_CPU_SSE41;
+
+	if(tier == UNICODER_CPU_SSE41  &&  __builtin_cpu_supports("avx2"))
+		tier= UNICODER_CPU_AVX2;
+
+	if(tier == UNICODER_CPU_AVX2  &&  __builtin_cpu_supports("avx512bw")  &&  __builtin_cpu_supports("avx512vl")
+	   &&  __builtin_cpu_supports("avx512vbmi2"))
+		tier= UNICODER_CPU_AVX512;
+#elif defined(UNICODER_AVX512)
+	tier= UNICODER_CPU_AVX512;
+#elif defined(UNICODER_AVX2)
+	tier= UNICODER_CPU_AVX2;
+#elif defined(UNICODER_SSE)
+	tier= UNICODER_CPU_SSE41;
+#endif
+
+	return tier;
+}
+
+
+/* the kernels of tier, or of the widest one under it that was compiled in */
+static const unicoder_kernelSet* unicoder_kernelsFor(unsigned int tier)
+{
+#if defined(UNICODER_AVX512)
+	if(tier >= UNICODER_CPU_AVX512)
+		return &unicoder_avx512Kernels;
+#endif
+
+#if defined(UNICODER_AVX2)
+	if(tier >= UNICODER_CPU_AVX2)
+		return &unicoder_avx2Kernels;
+#endif
+
+#if defined(UNICODER_SSE)
+	if(tier >= UNICODER_CPU_SSE41)
+		return &unicoder_sseKernels;
+#endif
+
+	(void) tier;
+	return &unicoder_scalarKernels;
+}
+
+
+/* the tier named by UNICODER_CPU, held to supported, or supported itself */
+static unsigned int unicoder_cpuRequested(unsigned int supported)
+{
+	static const char* const names[]= { "scalar", "sse4.1", "avx2", "avx512" };
+	const char* name;
+	unsigned int tier;
+
+	name= getenv("UNICODER_CPU");
+	if(name == NULL)
+		return supported;
+
+	for(tier= UNICODER_CPU_SCALAR; tier <= UNICODER_CPU_AVX512; tier++)
+	{
+		if(strcmp(name, names[tier]) == 0)
+			return (tier < supported) ? tier : supported;
+	}
+
+	return supported;
+}
+
+
+/* binds on first use; threads racing here all come up with the same set, and none of them */
+/* overwrites one unicoder_setCpuTier bound meanwhile */
+static const unicoder_kernelSet* unicoder_kernels(void)
+{
+	const unicoder_kernelSet* kernels;
+	const unicoder_kernelSet* detected;
+
+	kernels= UNICODER_LOAD_ACQUIRE(unicoder_kernelsBound);
+	if(kernels == NULL)
+	{
+		detected= unicoder_kernelsFor(unicoder_cpuRequested(unicoder_cpuSupported()));
+		if(UNICODER_SWAP_RELEASE(unicoder_kernelsBound, kernels, detected))
+			kernels= detected;
+	}
+
+	return kernels;
+}
+
+
+/* tier of the kernels in use, one of UNICODER_CPU_SCALAR to UNICODER_CPU_AVX512 */
+int unicoder_cpuTier(void)
+{
+	return (int) unicoder_kernels()->tier;
+}
+
+
+/* switches every thread to the kernels of tier, which overrides UNICODER_CPU */
+/* returns 0, or UNICODER_NOT_SUPPORTED and changes nothing if the cpu or the build lacks tier */
+int unicoder_setCpuTier(unsigned int tier)
+{
+	if(tier > unicoder_cpuSupported())
+		return UNICODER_NOT_SUPPORTED;
+
+	UNICODER_STORE_RELEASE(unicoder_kernelsBound, unicoder_kernelsFor(tier));
+	return 0;
+}
+
+
+
+
+
+
 #endif
@@ -21,6 +21,11 @@ Copyright (C) 2014 Justin Adams
 #define  UNICODER_H  1
 
 #include <stdio.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 /* error codes for function returns */
 #define  UNICODER_NULL_POINTER            -1
@@ -34,6 +39,11 @@ Copyright (C) 2014 Justin Adams
 #define  UNICODER_OUT_OF_ASCII_RANGE    -256
 #define  UNICODER_BAD_LENGTH            -512 /* from unicoder_reverseEndianness() */
 #define  UNICODER_UNPOSSIBLE           -1024 /* should never happen, indicates bug in this library */
+#define  UNICODER_OUTPUT_BUFFER_FULL   -2048 /* destination ran out of room before the source did */
+#define  UNICODER_INCOMPLETE_SEQUENCE  -4096 /* source ends in the middle of an otherwise valid code point */
+#define  UNICODER_NOT_SUPPORTED        -8192 /* feature was left out when the library was built */
+#define  UNICODER_NOT_IN_CODE_PAGE    -16384 /* code point has no byte in a single byte code page */
+#define  UNICODER_OUT_OF_MEMORY       -32768 /* an allocation failed */
 
 
 /* Codes for endianness types. */
@@ -51,6 +61,9 @@ Copyright (C) 2014 Justin Adams
 #define  UNICODER_UTF16LE  4
 #define  UNICODER_UTF32BE  5
 #define  UNICODER_UTF32LE  6
+#define  UNICODER_ISO8859_1   7 /* latin-1, the first 256 code points byte for byte */
+#define  UNICODER_ISO8859_15  8 /* latin-9, latin-1 with the euro sign and 7 other letters swapped in */
+#define  UNICODER_CP1252      9 /* windows-1252, latin-1 with printable characters in 80..9F */
 
 
 
@@ -61,6 +74,12 @@ int unicoder_getMachineEndianness();
 int unicoder_reverseEndianness(unsigned char* src, unsigned char* dest, unsigned int length);
 
 
+/* swaps the bytes of every unitSize (2 or 4) byte unit in len bytes from src to dst */
+/* dst may be src itself to swap in place, but must not overlap it otherwise; the contents are not checked */
+/* returns 0 or error code */
+int unicoder_swapByteOrder(const unsigned char* src, unsigned char* dst, size_t len, unsigned int unitSize);
+
+
 /* uses byte order mark to determine encoding type */
 int unicoder_decodeBom(unsigned char* p);
 
@@ -69,6 +88,17 @@ int unicoder_decodeBom(unsigned char* p);
 int unicoder_decodeBomFromFile(FILE* f);
 
 
+/* guesses the encoding of len bytes at buf from the first sampleLen of them (0 means 4096) */
+/* a byte order mark decides it outright; confidence (may be NULL) receives 0 to 100 for how sure the guess is */
+/* 8 bit text that is not utf-8 comes back as UNICODER_CP1252; returns an encoding, UNICODER_ASCII */
+/* with confidence 0 when nothing fits, or error code */
+int unicoder_detectEncoding(const unsigned char* buf, size_t len, size_t sampleLen, unsigned int* confidence);
+
+
+/* same as unicoder_detectEncoding for the start of file f, leaves the file position where it was */
+int unicoder_detectEncodingFromFile(FILE* f, size_t sampleLen, unsigned int* confidence);
+
+
 /* Remember, this is multi-byte endianness we are referring to, not bit-level endianness.
    Bit-level endianness is handled by hardware. */
 unsigned int unicoder_uint32_reverseByteEndian(unsigned int x);
@@ -109,6 +139,7 @@ int unicoder_readCodePoint(unsigned char* p, unsigned int* result, unsigned int
 
 
 /* reads single code point from file f, store in result, returns error code or number of bytes read */
+/* seeks after every code point, so f must be a regular file; unicoder_reader is much faster and works on pipes */
 int unicoder_readCodePointFromFile(FILE* f, unsigned int* result, unsigned int encoding);
 
 
@@ -131,4 +162,389 @@ int unicoder_writeCStringToFile(FILE* f, const char* cstr, unsigned int encoding
 
 
 
+
+/* converts srcLen bytes of src from srcEncoding into dst (at most dstCap bytes) using dstEncoding */
+/* consumed and produced (either may be NULL) receive how many bytes were read and written, even on error */
+/* on error consumed points at the offending sequence; returns 0 on success or error code */
+int unicoder_transcode(const unsigned char* src, size_t srcLen, unsigned int srcEncoding,
+                       unsigned char* dst, size_t dstCap, unsigned int dstEncoding,
+                       size_t* consumed, size_t* produced);
+
+
+/* checks that len bytes at buf are well formed utf-8 (no overlongs, surrogates or values past 0x10ffff) */
+/* returns 0 if so, otherwise error code with the offset of the first bad sequence stored in errorOffset (may be NULL) */
+int unicoder_utf8_validate(const unsigned char* buf, size_t len, size_t* errorOffset);
+
+
+
+
+
+/* buffered reader over a FILE, never seeks so pipes and stdin work */
+typedef struct unicoder_reader unicoder_reader;
+
+
+/* opens a reader on f, encoding 0 means take it from the byte order mark, returns NULL on failure */
+/* a byte order mark at the start is skipped, the caller still owns f but must not read it while the */
+/* reader is open; a pipe must not have been read through stdio beforehand either */
+unicoder_reader* unicoder_reader_open(FILE* f, unsigned int encoding);
+
+
+/* encoding the reader decodes, either the one it was opened with or the one the byte order mark gave */
+unsigned int unicoder_reader_encoding(const unicoder_reader* r);
+
+
+/* reads the next code point into result, returns number of bytes read, UNICODER_EOF at the end or error code */
+int unicoder_reader_readCodePoint(unicoder_reader* r, unsigned int* result);
+
+
+/* converts as much of the stream as is buffered into dst (at most dstCap bytes) using dstEncoding */
+/* produced (may be NULL) receives the number of bytes written; returns 0, UNICODER_EOF at the end or error code */
+int unicoder_reader_read(unicoder_reader* r, unsigned char* dst, size_t dstCap, unsigned int dstEncoding, size_t* produced);
+
+
+/* reads the next record of the stream, up to delimiter as for unicoder_splitter_init, pointing record */
+/* at it in the reader's buffer (valid until the next call on r) and storing its length in recordLen */
+/* returns 0, UNICODER_EOF at the end or error code */
+int unicoder_reader_readRecord(unicoder_reader* r, unsigned int delimiter, const unsigned char** record, size_t* recordLen);
+
+
+/* frees the reader, does not close the file it was reading; a file that seeks is left at the first */
+/* byte the reader did not hand out */
+void unicoder_reader_close(unicoder_reader* r);
+
+
+
+
+
+/* buffered writer over a FILE, output goes out one fwrite per buffer */
+typedef struct unicoder_writer unicoder_writer;
+
+
+/* opens a writer on f that encodes to encoding, puts a byte order mark first if bom is nonzero */
+/* returns NULL on failure, the caller still owns f */
+unicoder_writer* unicoder_writer_open(FILE* f, unsigned int encoding, int bom);
+
+
+/* writes single code point, returns number of bytes written or error code */
+int unicoder_writer_writeCodePoint(unicoder_writer* w, unsigned int x);
+
+
+/* writes srcLen bytes of src in srcEncoding (utf-8, utf-32 or any other) */
+/* a code point cut off at the end of src is held back until the next call completes it */
+/* consumed (may be NULL) receives how many bytes of src were taken, on error it points at the offending sequence */
+/* returns 0 or error code */
+int unicoder_writer_write(unicoder_writer* w, const unsigned char* src, size_t srcLen, unsigned int srcEncoding, size_t* consumed);
+
+
+/* hands everything buffered to fwrite, returns 0 or error code */
+int unicoder_writer_flush(unicoder_writer* w);
+
+
+/* flushes and frees the writer, does not close the file */
+/* returns 0, UNICODER_INCOMPLETE_SEQUENCE if the last span ended inside a code point, or error code from the flush */
+int unicoder_writer_close(unicoder_writer* w);
+
+
+
+
+
+/* what unicoder_transcodeFile did */
+typedef struct
+{
+	unsigned int srcEncoding; /* taken from the byte order mark, UNICODER_ASCII if there was none */
+	size_t bytesRead;
+	size_t bytesWritten;
+} unicoder_fileStats;
+
+
+/* transcodes the file at inPath into a new file at outPath using outEncoding */
+/* the source encoding comes from the byte order mark, which is written again in outEncoding if that is a utf */
+/* and dropped for the code pages */
+/* stats (may be NULL) gets the source encoding and the bytes read and written, on error bytesRead is the offset */
+/* of the offending sequence and the output holds everything before it; outPath naming the same file as */
+/* inPath is refused with UNICODER_FILE_IO_ERROR; returns 0 on success or error code */
+int unicoder_transcodeFile(const char* inPath, const char* outPath, unsigned int outEncoding, unicoder_fileStats* stats);
+
+
+
+
+
+/* exact number of bytes unicoder_transcode would write for srcLen bytes of src going from srcEncoding */
+/* to dstEncoding, stored in length; on error length covers what comes before the offending sequence */
+/* returns 0 or the error code unicoder_transcode would return */
+int unicoder_transcodedLength(const unsigned char* src, size_t srcLen, unsigned int srcEncoding,
+                              unsigned int dstEncoding, size_t* length);
+
+
+/* counts the code points in srcLen bytes of src, stored in count; on error count covers what comes */
+/* before the offending sequence; returns 0 or error code */
+int unicoder_countCodePoints(const unsigned char* src, size_t srcLen, unsigned int srcEncoding, size_t* count);
+
+
+/* converts len bytes of buf from srcEncoding to dstEncoding over themselves, newLen (may be NULL) */
+/* receives the length of the result; returns 0 or error code, UNICODER_OUTPUT_BUFFER_FULL if the */
+/* output would get ahead of the input, in which case buf is left as it was */
+/* on any other error newLen covers what came before the offending sequence and the rest of buf is lost */
+int unicoder_transcodeInPlace(unsigned char* buf, size_t len, unsigned int srcEncoding, unsigned int dstEncoding,
+                              size_t* newLen);
+
+
+/* same as unicoder_transcode, but splits the work over threads (0 means one per online processor) */
+/* small inputs, a single thread or a build without pthreads go straight to unicoder_transcode */
+int unicoder_transcodeParallel(const unsigned char* src, size_t srcLen, unsigned int srcEncoding,
+                               unsigned char* dst, size_t dstCap, unsigned int dstEncoding,
+                               size_t* consumed, size_t* produced, unsigned int threads);
+
+
+
+
+
+/* state for decoding a stream that arrives in chunks of any size, set up with unicoder_decoder_init */
+typedef struct
+{
+	unsigned int srcEncoding;
+	unsigned int dstEncoding;
+	unsigned char pending[4]; /* start of a code point cut off by the end of the last chunk */
+	unsigned int pendingLen;
+} unicoder_decoder;
+
+
+/* sets up d to turn srcEncoding into dstEncoding (UNICODER_UTF32LE or BE for plain code points), returns 0 or error code */
+int unicoder_decoder_init(unicoder_decoder* d, unsigned int srcEncoding, unsigned int dstEncoding);
+
+
+/* converts the next srcLen bytes of the stream into dst (at most dstCap bytes) */
+/* consumed and produced (either may be NULL) work as for unicoder_transcode; bytes held back for */
+/* the next chunk count as consumed; returns 0 or error code, UNICODER_OUTPUT_BUFFER_FULL means */
+/* call again with the rest of the chunk */
+int unicoder_decoder_decode(unicoder_decoder* d, const unsigned char* src, size_t srcLen,
+                            unsigned char* dst, size_t dstCap, size_t* consumed, size_t* produced);
+
+
+/* ends the stream, returns UNICODER_INCOMPLETE_SEQUENCE if it stopped in the middle of a code point, 0 otherwise */
+/* d is ready for a new stream afterwards */
+int unicoder_decoder_finish(unicoder_decoder* d);
+
+
+
+
+
+/* what unicoder_transcodeLossy does with a bad sequence or a code point the destination cannot take */
+#define  UNICODER_POLICY_STRICT   0 /* stop there, as unicoder_transcode does */
+#define  UNICODER_POLICY_REPLACE  1 /* write U+FFFD ('?' for ascii and code pages) in place of each maximal subpart */
+#define  UNICODER_POLICY_SKIP     2 /* leave it out */
+
+
+/* same as unicoder_transcode, but what it does with a bad sequence, or a code point dstEncoding */
+/* cannot take, is up to policy; errorOffsets (may be NULL if maxErrors is 0) receives the offsets */
+/* of the first maxErrors of them and errorCount (may be NULL) how many there were; returns 0, */
+/* UNICODER_OUTPUT_BUFFER_FULL (call again from consumed) or error code */
+int unicoder_transcodeLossy(const unsigned char* src, size_t srcLen, unsigned int srcEncoding,
+                            unsigned char* dst, size_t dstCap, unsigned int dstEncoding, unsigned int policy,
+                            size_t* errorOffsets, size_t maxErrors, size_t* errorCount,
+                            size_t* consumed, size_t* produced);
+
+
+
+
+
+/* general categories, as unicoder_generalCategory returns them */
+#define  UNICODER_CATEGORY_CN   0 /* unassigned, also what anything past 0x10ffff gets */
+#define  UNICODER_CATEGORY_LU   1
+#define  UNICODER_CATEGORY_LL   2
+#define  UNICODER_CATEGORY_LT   3
+#define  UNICODER_CATEGORY_LM   4
+#define  UNICODER_CATEGORY_LO   5
+#define  UNICODER_CATEGORY_MN   6
+#define  UNICODER_CATEGORY_MC   7
+#define  UNICODER_CATEGORY_ME   8
+#define  UNICODER_CATEGORY_ND   9
+#define  UNICODER_CATEGORY_NL  10
+#define  UNICODER_CATEGORY_NO  11
+#define  UNICODER_CATEGORY_PC  12
+#define  UNICODER_CATEGORY_PD  13
+#define  UNICODER_CATEGORY_PS  14
+#define  UNICODER_CATEGORY_PE  15
+#define  UNICODER_CATEGORY_PI  16
+#define  UNICODER_CATEGORY_PF  17
+#define  UNICODER_CATEGORY_PO  18
+#define  UNICODER_CATEGORY_SM  19
+#define  UNICODER_CATEGORY_SC  20
+#define  UNICODER_CATEGORY_SK  21
+#define  UNICODER_CATEGORY_SO  22
+#define  UNICODER_CATEGORY_ZS  23
+#define  UNICODER_CATEGORY_ZL  24
+#define  UNICODER_CATEGORY_ZP  25
+#define  UNICODER_CATEGORY_CC  26
+#define  UNICODER_CATEGORY_CF  27
+#define  UNICODER_CATEGORY_CS  28
+#define  UNICODER_CATEGORY_CO  29
+
+/* answers of the nfc quick check */
+#define  UNICODER_NFC_YES    0
+#define  UNICODER_NFC_NO     1
+#define  UNICODER_NFC_MAYBE  2 /* only a full normalization can tell */
+
+
+/* general category of code point x, one of the UNICODER_CATEGORY_ constants */
+unsigned int unicoder_generalCategory(unsigned int x);
+
+
+/* canonical combining class of code point x, 0 for starters */
+unsigned int unicoder_combiningClass(unsigned int x);
+
+
+/* NFC_Quick_Check property of code point x, UNICODER_NFC_YES, UNICODER_NFC_NO or UNICODER_NFC_MAYBE */
+unsigned int unicoder_nfcQuickCheckCodePoint(unsigned int x);
+
+
+/* quick check of len bytes at buf in encoding against normalization form C (uax #15) */
+/* returns UNICODER_NFC_YES, UNICODER_NFC_NO, UNICODER_NFC_MAYBE or error code for a bad sequence */
+int unicoder_nfcQuickCheck(const unsigned char* buf, size_t len, unsigned int encoding);
+
+
+/* simple case folding of code point x, x itself if it does not fold */
+unsigned int unicoder_foldCase(unsigned int x);
+
+
+/* simple case folding of srcLen bytes of src into dst (at most dstCap bytes), in the same encoding */
+/* consumed and produced (either may be NULL) work as for unicoder_transcode; a code point whose */
+/* folding a code page cannot hold is left as it is; dst may be src itself for any encoding but */
+/* utf-8, whose foldings can be longer, and must not overlap it otherwise; returns 0 or error code */
+int unicoder_caseFold(const unsigned char* src, size_t srcLen, unsigned int encoding,
+                      unsigned char* dst, size_t dstCap, size_t* consumed, size_t* produced);
+
+
+
+
+
+/* where every interval-th code point of a text starts, for seeking by code point number */
+typedef struct unicoder_index unicoder_index;
+
+
+/* opens an empty index for text in encoding, with an entry every interval code points (0 means 1024) */
+/* the index keeps offsets only, the text stays with the caller; returns NULL on failure */
+unicoder_index* unicoder_index_open(unsigned int encoding, size_t interval);
+
+
+/* brings the index up to the first len bytes of text, which has to start with the bytes indexed so far */
+/* (text may have moved since); a code point cut off at the end is left for the next append */
+/* returns 0 or error code, the index then covering what comes before the offending sequence */
+int unicoder_index_append(unicoder_index* ix, const unsigned char* text, size_t len);
+
+
+/* code points and bytes of text the index covers (either may be NULL) */
+void unicoder_index_length(const unicoder_index* ix, size_t* codePoints, size_t* bytes);
+
+
+/* byte offset in text of code point n, where n may be the number of code points indexed for the end */
+/* scans fewer than interval code points; returns 0, UNICODER_EOF if n is past the end, or error code */
+int unicoder_index_seek(const unicoder_index* ix, const unsigned char* text, size_t n, size_t* offset);
+
+
+/* bytes [start, end) of text holding code points first up to but not including last, no copying */
+/* returns 0, UNICODER_EOF if last is past the end, UNICODER_BAD_LENGTH if first is past last, or error code */
+int unicoder_index_slice(const unicoder_index* ix, const unsigned char* text, size_t first, size_t last,
+                         size_t* start, size_t* end);
+
+
+/* frees the index, not the text */
+void unicoder_index_close(unicoder_index* ix);
+
+
+
+
+
+#define  UNICODER_LINES  0x110000 /* delimiter for records ending in LF, with a CR before it dropped too */
+
+
+/* state for splitting a text into records, set up with unicoder_splitter_init */
+typedef struct
+{
+	const unsigned char* text;
+	size_t len;
+	size_t next; /* where the next record starts */
+	unsigned int unitSize; /* the delimiter is only looked for at multiples of this from the start */
+	unsigned int delimiterLen, carriageReturnLen; /* carriageReturnLen is 0 but for UNICODER_LINES */
+	unsigned char delimiter[4], carriageReturn[4]; /* both in the encoding of the text */
+} unicoder_splitter;
+
+
+/* sets up s to split len bytes of text in encoding into records ending in delimiter, a code point or */
+/* UNICODER_LINES for LF with an optional CR before it; returns 0 or error code, for one if delimiter */
+/* cannot be written in encoding */
+int unicoder_splitter_init(unicoder_splitter* s, const unsigned char* text, size_t len, unsigned int encoding, unsigned int delimiter);
+
+
+/* points record at the next record of the text and stores its length in bytes, without the delimiter, */
+/* in recordLen; the record is part of the text, nothing is copied; text that ends in a delimiter has no */
+/* empty record after it; returns 0, UNICODER_EOF when there are no more records or error code */
+int unicoder_splitter_next(unicoder_splitter* s, const unsigned char** record, size_t* recordLen);
+
+
+
+
+
+/* counters kept by a library built with UNICODER_STATS defined, plus timers if UNICODER_STATS_TIMERS is too */
+/* without them none of this costs anything and unicoder_stats_snapshot returns UNICODER_NOT_SUPPORTED */
+#define  UNICODER_STATS_ENCODINGS  16 /* arrays indexed by UNICODER_ASCII and friends */
+#define  UNICODER_STATS_ERRORS     16 /* errors[i] counts returns of error code -(1 << i), so errors[3] is UNICODER_INVALID_BYTE_SEQUENCE */
+
+/* what the timers are kept for, each includes everything under it */
+#define  UNICODER_TIMER_TRANSCODE       0 /* unicoder_transcode, which the reader, writer, decoder and file paths go through */
+#define  UNICODER_TIMER_VALIDATE        1 /* unicoder_utf8_validate */
+#define  UNICODER_TIMER_TRANSCODE_FILE  2 /* unicoder_transcodeFile */
+#define  UNICODER_TIMER_READER_IO       3 /* reads of the file by unicoder_reader */
+#define  UNICODER_TIMER_WRITER_IO       4 /* fwrite by unicoder_writer */
+#define  UNICODER_TIMERS                8
+
+typedef struct
+{
+	unsigned long long codePointsRead[UNICODER_STATS_ENCODINGS];
+	unsigned long long bytesRead[UNICODER_STATS_ENCODINGS];
+	unsigned long long codePointsWritten[UNICODER_STATS_ENCODINGS];
+	unsigned long long bytesWritten[UNICODER_STATS_ENCODINGS];
+	unsigned long long errors[UNICODER_STATS_ERRORS];
+	unsigned long long calls[UNICODER_TIMERS];
+	unsigned long long cycles[UNICODER_TIMERS]; /* time stamp counter ticks on x86, nanoseconds elsewhere */
+} unicoder_stats;
+
+
+/* counted are unicoder_transcode and everything built on it, unicoder_readCodePoint, unicoder_writeCodePoint */
+/* and the functions built on those, and unicoder_reader_readCodePoint; counters are shared by all threads */
+/* copies the counters into stats, returns 0 or error code */
+int unicoder_stats_snapshot(unicoder_stats* stats);
+
+
+/* sets every counter back to 0 */
+void unicoder_stats_reset(void);
+
+
+
+
+
+/* vector kernel tiers, the widest one the cpu has is used unless UNICODER_CPU in the environment */
+/* (scalar, sse4.1, avx2 or avx512) or unicoder_setCpuTier asks for a narrower one */
+#define  UNICODER_CPU_SCALAR  0
+#define  UNICODER_CPU_SSE41   1 /* sse4.1, which every sse4.2 cpu has */
+#define  UNICODER_CPU_AVX2    2
+#define  UNICODER_CPU_AVX512  3 /* avx512bw, avx512vl and avx512vbmi2, ice lake and later */
+
+
+/* tier of the kernels in use, one of UNICODER_CPU_SCALAR to UNICODER_CPU_AVX512 */
+int unicoder_cpuTier(void);
+
+
+/* switches every thread to the kernels of tier, which overrides UNICODER_CPU */
+/* returns 0, or UNICODER_NOT_SUPPORTED and changes nothing if the cpu or the build lacks tier */
+int unicoder_setCpuTier(unsigned int tier);
+
+
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
@@ -0,0 +1,1077 @@
+/******
+Copyright (C) 2014 Justin Adams
+
+    This file is part of Unicoder.
+
+    Unicoder is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License
+    (version 2.1 only) as published by the Free Software Foundation.
+
+    Unicoder is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with Unicoder.  If not, see <http://www.gnu.org/licenses/>.
+****/
+
+
+/*
+C++ codecs.
+
+unicoder::codec<E> is the read and write step of unicoder.c for one encoding, with E a template
+argument instead of a switch, so a loop over codec<E>::decode and codec<E>::encode is inlined
+whole and the optimizer sees every branch. The rules and error codes are those of unicoder.c:
+decode takes what unicoder_utf8_decode and friends take (no overlongs, no surrogates, nothing
+past 0x10ffff) but never looks past the bytes it is given, and encode refuses what
+unicoder_writeCodePoint refuses. The code pages go through the tables unicoder.c uses, from
+unicoder_codepages.h. Everything here is constexpr and needs nothing linked in.
+
+On top of the codecs sit unicoder::transcode<From, To>, the same loop unicoder_transcode runs for
+a pair without vector kernels, and two views: decode_view turns bytes into char32_t code points
+and encode_view turns code points back into bytes. A view stops at the first error and keeps it,
+so a range for loop runs to the end or to the bad sequence and error() tells which. With C++20
+they are std::ranges views. Long buffers still go faster through unicoder_transcode, which has
+the vector kernels; this header is for the per code point loops around it.
+*/
+
+
+#ifndef  UNICODER_HPP
+#define  UNICODER_HPP  1
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+
+#if __cplusplus >= 202002L  &&  defined(__has_include)
+#if __has_include(<ranges>)
+#include <ranges>
+#define  UNICODER_HPP_RANGES  1
+#endif
+#endif
+
+#include "unicoder.h"
+#include "unicoder_codepages.h"
+
+
+namespace unicoder
+{
+
+namespace detail
+{
+	/* every scalar value: up to 0x10ffff and not a surrogate */
+	constexpr bool isCodePoint(char32_t x) noexcept
+	{
+		return x <= 0x10ffff  &&  (x < 0xd800  ||  0xdfff < x);
+	}
+
+
+	template<unsigned int Endianness>
+	constexpr unsigned int load16(const unsigned char* p) noexcept
+	{
+		if(Endianness == UNICODER_LES)
+			return ((unsigned int) p[1] << 8) | p[0];
+		else
+			return ((unsigned int) p[0] << 8) | p[1];
+	}
+
+
+	template<unsigned int Endianness>
+	constexpr unsigned int load32(const unsigned char* p) noexcept
+	{
+		if(Endianness == UNICODER_LES)
+			return ((unsigned int) p[3] << 24) | ((unsigned int) p[2] << 16) | ((unsigned int) p[1] << 8) | p[0];
+		else
+			return ((unsigned int) p[0] << 24) | ((unsigned int) p[1] << 16) | ((unsigned int) p[2] << 8) | p[3];
+	}
+
+
+	template<unsigned int Endianness>
+	constexpr void store16(unsigned char* p, unsigned int x) noexcept
+	{
+		if(Endianness == UNICODER_LES)
+		{
+			p[0]= (unsigned char) (x & 0xff);
+			p[1]= (unsigned char) ((x >> 8) & 0xff);
+		}
+
+		else
+		{
+			p[0]= (unsigned char) ((x >> 8) & 0xff);
+			p[1]= (unsigned char) (x & 0xff);
+		}
+	}
+
+
+	template<unsigned int Endianness>
+	constexpr void store32(unsigned char* p, unsigned int x) noexcept
+	{
+		if(Endianness == UNICODER_LES)
+		{
+			p[0]= (unsigned char) (x & 0xff);
+			p[1]= (unsigned char) ((x >> 8) & 0xff);
+			p[2]= (unsigned char) ((x >> 16) & 0xff);
+			p[3]= (unsigned char) ((x >> 24) & 0xff);
+		}
+
+		else
+		{
+			p[0]= (unsigned char) ((x >> 24) & 0xff);
+			p[1]= (unsigned char) ((x >> 16) & 0xff);
+			p[2]= (unsigned char) ((x >> 8) & 0xff);
+			p[3]= (unsigned char) (x & 0xff);
+		}
+	}
+
+
+	template<unsigned int Endianness>
+	struct utf16
+	{
+		static constexpr std::size_t unit_size= 2;
+		static constexpr std::size_t max_length= 4;
+
+		static constexpr int decode(const unsigned char* p, std::size_t avail, char32_t& cp) noexcept
+		{
+			unsigned int dbyteA= 0, dbyteB= 0;
+
+			if(avail < 2)
+				return UNICODER_INCOMPLETE_SEQUENCE;
+
+			dbyteA= load16<Endianness>(p);
+
+			if(dbyteA < 0xd800  ||  0xdfff < dbyteA)
+			{
+				cp= dbyteA;
+				return 2;
+			}
+
+			/* low surrogate with no high surrogate in front of it */
+			if(dbyteA > 0xdbff)
+				return UNICODER_INVALID_BYTE_SEQUENCE;
+
+			if(avail < 4)
+				return UNICODER_INCOMPLETE_SEQUENCE;
+
+			dbyteB= load16<Endianness>(p + 2);
+			if(dbyteB < 0xdc00  ||  0xdfff < dbyteB)
+				return UNICODER_INVALID_BYTE_SEQUENCE;
+
+			cp= (((dbyteA & 0x03ff) << 10) | (dbyteB & 0x03ff)) + 0x010000;
+			return 4;
+		}
+
+		static constexpr int length(char32_t cp) noexcept
+		{
+			if(!isCodePoint(cp))
+				return UNICODER_INVALID_CODE_POINT;
+
+			return (cp < 0x010000) ? 2 : 4;
+		}
+
+		static constexpr int encode(unsigned char* p, std::size_t avail, char32_t cp) noexcept
+		{
+			unsigned int uPrime= 0;
+			int n= length(cp);
+
+			if(n < 0)
+				return n;
+
+			if(avail < (std::size_t) n)
+				return UNICODER_OUTPUT_BUFFER_FULL;
+
+			if(n == 2)
+			{
+				store16<Endianness>(p, cp);
+				return 2;
+			}
+
+			/* high surrogate always appears first */
+			uPrime= cp - 0x010000;
+			store16<Endianness>(p, 0xd800 | (uPrime >> 10));
+			store16<Endianness>(p + 2, 0xdc00 | (uPrime & 0x03ff));
+			return 4;
+		}
+	};
+
+
+	template<unsigned int Endianness>
+	struct utf32
+	{
+		static constexpr std::size_t unit_size= 4;
+		static constexpr std::size_t max_length= 4;
+
+		static constexpr int decode(const unsigned char* p, std::size_t avail, char32_t& cp) noexcept
+		{
+			unsigned int decoded= 0;
+
+			if(avail < 4)
+				return UNICODER_INCOMPLETE_SEQUENCE;
+
+			decoded= load32<Endianness>(p);
+			if(!isCodePoint(decoded))
+				return UNICODER_INVALID_CODE_POINT;
+
+			cp= decoded;
+			return 4;
+		}
+
+		static constexpr int length(char32_t cp) noexcept
+		{
+			return isCodePoint(cp) ? 4 : UNICODER_INVALID_CODE_POINT;
+		}
+
+		static constexpr int encode(unsigned char* p, std::size_t avail, char32_t cp) noexcept
+		{
+			if(!isCodePoint(cp))
+				return UNICODER_INVALID_CODE_POINT;
+
+			if(avail < 4)
+				return UNICODER_OUTPUT_BUFFER_FULL;
+
+			store32<Endianness>(p, cp);
+			return 4;
+		}
+	};
+
+
+	/* byte of cp in a code page with a table, or UNICODER_NOT_IN_CODE_PAGE: its own byte if the */
+	/* table gives it back there, otherwise a binary search of the code points that moved */
+	template<std::size_t MovedCount>
+	constexpr int codePageByte(const unsigned short (&decode)[256], const unicoder_codePageEntry (&moved)[MovedCount],
+	                           char32_t cp) noexcept
+	{
+		std::size_t low= 0, high= MovedCount, middle= 0;
+
+		if(cp < 0x100  &&  decode[cp] == cp)
+			return (int) cp;
+
+		while(low < high)
+		{
+			middle= (low + high) / 2;
+			if(moved[middle].codePoint < cp)
+				low= middle + 1;
+			else
+				high= middle;
+		}
+
+		if(low < MovedCount  &&  moved[low].codePoint == cp)
+			return moved[low].byte;
+
+		return UNICODER_NOT_IN_CODE_PAGE;
+	}
+
+
+	/* ISO-8859-15 or windows-1252 */
+	template<unsigned int Encoding>
+	struct codePage
+	{
+		static constexpr std::size_t unit_size= 1;
+		static constexpr std::size_t max_length= 1;
+
+		static constexpr int decode(const unsigned char* p, std::size_t avail, char32_t& cp) noexcept
+		{
+			(void) avail;
+
+			cp= (Encoding == UNICODER_ISO8859_15) ? unicoder_iso8859_15Decode[p[0]] : unicoder_cp1252Decode[p[0]];
+			return 1;
+		}
+
+		static constexpr int length(char32_t cp) noexcept
+		{
+			int byte= (Encoding == UNICODER_ISO8859_15)
+			          ? codePageByte(unicoder_iso8859_15Decode, unicoder_iso8859_15Moved, cp)
+			          : codePageByte(unicoder_cp1252Decode, unicoder_cp1252Moved, cp);
+
+			return (byte < 0) ? byte : 1;
+		}
+
+		static constexpr int encode(unsigned char* p, std::size_t avail, char32_t cp) noexcept
+		{
+			int byte= (Encoding == UNICODER_ISO8859_15)
+			          ? codePageByte(unicoder_iso8859_15Decode, unicoder_iso8859_15Moved, cp)
+			          : codePageByte(unicoder_cp1252Decode, unicoder_cp1252Moved, cp);
+
+			if(byte < 0)
+				return byte;
+
+			if(avail < 1)
+				return UNICODER_OUTPUT_BUFFER_FULL;
+
+			p[0]= (unsigned char) byte;
+			return 1;
+		}
+	};
+}
+
+
+
+/* one encoding's steps, E is one of UNICODER_ASCII to UNICODER_CP1252; each has */
+/*   encoding, unit_size, max_length */
+/*   decode(p, avail, cp): one code point from p, which has avail > 0 bytes, into cp; */
+/*                         returns bytes read or error code, never reads past avail */
+/*   length(cp):           bytes cp takes, or error code */
+/*   encode(p, avail, cp): cp to p, which has room for avail bytes; returns bytes written or error code */
+template<unsigned int Encoding>
+struct codec;
+
+
+template<>
+struct codec<UNICODER_ASCII>
+{
+	static constexpr unsigned int encoding= UNICODER_ASCII;
+	static constexpr std::size_t unit_size= 1;
+	static constexpr std::size_t max_length= 1;
+
+	static constexpr int decode(const unsigned char* p, std::size_t avail, char32_t& cp) noexcept
+	{
+		(void) avail;
+
+		if(p[0] > 0x7f)
+			return UNICODER_INVALID_BYTE_SEQUENCE;
+
+		cp= p[0];
+		return 1;
+	}
+
+	static constexpr int length(char32_t cp) noexcept
+	{
+		return (cp > 0x7f) ? UNICODER_OUT_OF_ASCII_RANGE : 1;
+	}
+
+	static constexpr int encode(unsigned char* p, std::size_t avail, char32_t cp) noexcept
+	{
+		if(cp > 0x7f)
+			return UNICODER_OUT_OF_ASCII_RANGE;
+
+		if(avail < 1)
+			return UNICODER_OUTPUT_BUFFER_FULL;
+
+		p[0]= (unsigned char) cp;
+		return 1;
+	}
+};
+
+
+template<>
+struct codec<UNICODER_UTF8>
+{
+	static constexpr unsigned int encoding= UNICODER_UTF8;
+	static constexpr std::size_t unit_size= 1;
+	static constexpr std::size_t max_length= 4;
+
+	/* the well formed sequences of the unicode standard, table 3-7: the lead decides the length */
+	/* and the range of the first continuation, which is where overlongs, surrogates and values */
+	/* past 0x10ffff show up; the same sequences unicoder_utf8_decode's state machine accepts */
+	static constexpr int decode(const unsigned char* p, std::size_t avail, char32_t& cp) noexcept
+	{
+		unsigned int lead= p[0], length= 0, low= 0x80, high= 0xbf, decoded= 0, i= 0;
+
+		if(lead < 0x80)
+		{
+			cp= lead;
+			return 1;
+		}
+
+		if(lead < 0xc2  ||  lead > 0xf4)
+			return UNICODER_INVALID_BYTE_SEQUENCE;
+
+		if(lead < 0xe0)
+		{
+			length= 2;
+			decoded= lead & 0x1f;
+		}
+
+		else if(lead < 0xf0)
+		{
+			length= 3;
+			decoded= lead & 0x0f;
+			if(lead == 0xe0)
+				low= 0xa0;
+			else if(lead == 0xed)
+				high= 0x9f;
+		}
+
+		else
+		{
+			length= 4;
+			decoded= lead & 0x07;
+			if(lead == 0xf0)
+				low= 0x90;
+			else if(lead == 0xf4)
+				high= 0x8f;
+		}
+
+		for(i= 1; i < length; i++)
+		{
+			if(i == avail)
+				return UNICODER_INCOMPLETE_SEQUENCE;
+
+			if(p[i] < low  ||  high < p[i])
+				return UNICODER_INVALID_BYTE_SEQUENCE;
+
+			decoded= (decoded << 6) | (p[i] & 0x3f);
+			low= 0x80;
+			high= 0xbf;
+		}
+
+		cp= decoded;
+		return (int) length;
+	}
+
+	static constexpr int length(char32_t cp) noexcept
+	{
+		if(!detail::isCodePoint(cp))
+			return UNICODER_INVALID_CODE_POINT;
+
+		return 1 + (cp > 0x7f) + (cp > 0x07ff) + (cp > 0xffff);
+	}
+
+	static constexpr int encode(unsigned char* p, std::size_t avail, char32_t cp) noexcept
+	{
+		int n= length(cp);
+
+		if(n < 0)
+			return n;
+
+		if(avail < (std::size_t) n)
+			return UNICODER_OUTPUT_BUFFER_FULL;
+
+		switch(n)
+		{
+			case 1:
+				p[0]= (unsigned char) cp;
+				break;
+
+			case 2:
+				p[0]= (unsigned char) (0xc0 | (cp >> 6));
+				p[1]= (unsigned char) (0x80 | (cp & 0x3f));
+				break;
+
+			case 3:
+				p[0]= (unsigned char) (0xe0 | (cp >> 12));
+				p[1]= (unsigned char) (0x80 | ((cp >> 6) & 0x3f));
+				p[2]= (unsigned char) (0x80 | (cp & 0x3f));
+				break;
+
+			default:
+				p[0]= (unsigned char) (0xf0 | (cp >> 18));
+				p[1]= (unsigned char) (0x80 | ((cp >> 12) & 0x3f));
+				p[2]= (unsigned char) (0x80 | ((cp >> 6) & 0x3f));
+				p[3]= (unsigned char) (0x80 | (cp & 0x3f));
+				break;
+		}
+
+		return n;
+	}
+};
+
+
+template<>
+struct codec<UNICODER_UTF16BE> : detail::utf16<UNICODER_BES>
+{
+	static constexpr unsigned int encoding= UNICODER_UTF16BE;
+};
+
+
+template<>
+struct codec<UNICODER_UTF16LE> : detail::utf16<UNICODER_LES>
+{
+	static constexpr unsigned int encoding= UNICODER_UTF16LE;
+};
+
+
+template<>
+struct codec<UNICODER_UTF32BE> : detail::utf32<UNICODER_BES>
+{
+	static constexpr unsigned int encoding= UNICODER_UTF32BE;
+};
+
+
+template<>
+struct codec<UNICODER_UTF32LE> : detail::utf32<UNICODER_LES>
+{
+	static constexpr unsigned int encoding= UNICODER_UTF32LE;
+};
+
+
+/* the first 256 code points byte for byte */
+template<>
+struct codec<UNICODER_ISO8859_1>
+{
+	static constexpr unsigned int encoding= UNICODER_ISO8859_1;
+	static constexpr std::size_t unit_size= 1;
+	static constexpr std::size_t max_length= 1;
+
+	static constexpr int decode(const unsigned char* p, std::size_t avail, char32_t& cp) noexcept
+	{
+		(void) avail;
+
+		cp= p[0];
+		return 1;
+	}
+
+	static constexpr int length(char32_t cp) noexcept
+	{
+		return (cp > 0xff) ? UNICODER_NOT_IN_CODE_PAGE : 1;
+	}
+
+	static constexpr int encode(unsigned char* p, std::size_t avail, char32_t cp) noexcept
+	{
+		if(cp > 0xff)
+			return UNICODER_NOT_IN_CODE_PAGE;
+
+		if(avail < 1)
+			return UNICODER_OUTPUT_BUFFER_FULL;
+
+		p[0]= (unsigned char) cp;
+		return 1;
+	}
+};
+
+
+template<>
+struct codec<UNICODER_ISO8859_15> : detail::codePage<UNICODER_ISO8859_15>
+{
+	static constexpr unsigned int encoding= UNICODER_ISO8859_15;
+};
+
+
+template<>
+struct codec<UNICODER_CP1252> : detail::codePage<UNICODER_CP1252>
+{
+	static constexpr unsigned int encoding= UNICODER_CP1252;
+};
+
+
+
+
+
+
+/* converts srcLen bytes of src from From into dst (at most dstCap bytes) in To, the loop of */
+/* unicoder_transcode with both steps inlined; consumed and produced (either may be NULL) receive */
+/* how many bytes were read and written, even on error; returns 0 or error code */
+template<unsigned int From, unsigned int To>
+constexpr int transcode(const unsigned char* src, std::size_t srcLen,
+                        unsigned char* dst, std::size_t dstCap,
+                        std::size_t* consumed, std::size_t* produced) noexcept
+{
+	std::size_t in= 0, out= 0;
+	int bytesRead= 0, bytesWritten= 0, ret= 0;
+	char32_t x= 0;
+
+	while(in < srcLen)
+	{
+		bytesRead= codec<From>::decode(src + in, srcLen - in, x);
+		if(bytesRead < 0)
+		{
+			ret= bytesRead;
+			break;
+		}
+
+		bytesWritten= codec<To>::encode(dst + out, dstCap - out, x);
+		if(bytesWritten < 0)
+		{
+			ret= bytesWritten;
+			break;
+		}
+
+		in += bytesRead;
+		out += bytesWritten;
+	}
+
+	if(consumed != nullptr)
+		*consumed= in;
+
+	if(produced != nullptr)
+		*produced= out;
+
+	return ret;
+}
+
+
+
+
+
+
+/* the code points in a run of bytes in Encoding; iterating stops at the end or at the first */
+/* sequence that does not decode, and then error() and error_offset() say what and where */
+/* the bytes must outlive the view, and the view its iterators */
+template<unsigned int Encoding>
+class decode_view
+#if defined(UNICODER_HPP_RANGES)
+	: public std::ranges::view_interface<decode_view<Encoding>>
+#endif
+{
+public:
+	struct sentinel
+	{
+	};
+
+
+	class iterator
+	{
+	public:
+		using value_type= char32_t;
+		using difference_type= std::ptrdiff_t;
+		using reference= char32_t;
+		using pointer= void;
+		using iterator_category= std::input_iterator_tag;
+#if defined(UNICODER_HPP_RANGES)
+		using iterator_concept= std::forward_iterator_tag;
+#endif
+
+		constexpr iterator() noexcept= default;
+
+		constexpr iterator(decode_view* parent, const unsigned char* p) noexcept
+			: parent_(parent), p_(p)
+		{
+			read();
+		}
+
+		constexpr char32_t operator*() const noexcept
+		{
+			return cp_;
+		}
+
+		constexpr iterator& operator++() noexcept
+		{
+			p_ += length_;
+			read();
+			return *this;
+		}
+
+		constexpr iterator operator++(int) noexcept
+		{
+			iterator before= *this;
+
+			++*this;
+			return before;
+		}
+
+		/* bytes from the start of the view to the current code point */
+		constexpr std::size_t offset() const noexcept
+		{
+			return (std::size_t) (p_ - parent_->first_);
+		}
+
+		/* bytes the current code point takes */
+		constexpr std::size_t length() const noexcept
+		{
+			return length_;
+		}
+
+		friend constexpr bool operator==(const iterator& a, const iterator& b) noexcept
+		{
+			return a.p_ == b.p_;
+		}
+
+		friend constexpr bool operator!=(const iterator& a, const iterator& b) noexcept
+		{
+			return a.p_ != b.p_;
+		}
+
+		friend constexpr bool operator==(const iterator& a, sentinel) noexcept
+		{
+			return a.length_ == 0;
+		}
+
+		friend constexpr bool operator!=(const iterator& a, sentinel) noexcept
+		{
+			return a.length_ != 0;
+		}
+
+		friend constexpr bool operator==(sentinel, const iterator& a) noexcept
+		{
+			return a.length_ == 0;
+		}
+
+		friend constexpr bool operator!=(sentinel, const iterator& a) noexcept
+		{
+			return a.length_ != 0;
+		}
+
+	private:
+		/* decodes the code point at p_, or ends the iteration there */
+		constexpr void read() noexcept
+		{
+			int n= 0;
+
+			length_= 0;
+			if(p_ == parent_->last_)
+				return;
+
+			n= codec<Encoding>::decode(p_, (std::size_t) (parent_->last_ - p_), cp_);
+			if(n < 0)
+			{
+				parent_->error_= n;
+				parent_->errorOffset_= (std::size_t) (p_ - parent_->first_);
+				p_= parent_->last_;
+				return;
+			}
+
+			length_= (std::size_t) n;
+		}
+
+		decode_view* parent_= nullptr;
+		const unsigned char* p_= nullptr;
+		char32_t cp_= 0;
+		std::size_t length_= 0;
+	};
+
+
+	constexpr decode_view() noexcept= default;
+
+	constexpr decode_view(const unsigned char* p, std::size_t len) noexcept
+		: first_(p), last_(p + len)
+	{
+	}
+
+	constexpr iterator begin() noexcept
+	{
+		error_= 0;
+		errorOffset_= 0;
+		return iterator(this, first_);
+	}
+
+	constexpr sentinel end() const noexcept
+	{
+		return sentinel();
+	}
+
+	/* 0, or the error code of the sequence that stopped the last iteration */
+	constexpr int error() const noexcept
+	{
+		return error_;
+	}
+
+	/* bytes from the start of the view to that sequence */
+	constexpr std::size_t error_offset() const noexcept
+	{
+		return errorOffset_;
+	}
+
+private:
+	const unsigned char* first_= nullptr;
+	const unsigned char* last_= nullptr;
+	int error_= 0;
+	std::size_t errorOffset_= 0;
+};
+
+
+/* the bytes of a run of code points in Encoding; iterating stops at the end or at the first code */
+/* point Encoding cannot take, and then error() and error_index() say what and which one */
+template<unsigned int Encoding, class Iterator, class Sentinel= Iterator>
+class encode_view
+#if defined(UNICODER_HPP_RANGES)
+	: public std::ranges::view_interface<encode_view<Encoding, Iterator, Sentinel>>
+#endif
+{
+public:
+	struct sentinel
+	{
+	};
+
+
+	class iterator
+	{
+	public:
+		using value_type= unsigned char;
+		using difference_type= std::ptrdiff_t;
+		using reference= unsigned char;
+		using pointer= void;
+		using iterator_category= std::input_iterator_tag;
+#if defined(UNICODER_HPP_RANGES)
+		using iterator_concept= std::input_iterator_tag;
+#endif
+
+		constexpr iterator()= default;
+
+		constexpr iterator(encode_view* parent, Iterator it)
+			: parent_(parent), it_(it)
+		{
+			fill();
+		}
+
+		constexpr unsigned char operator*() const noexcept
+		{
+			return bytes_[next_];
+		}
+
+		constexpr iterator& operator++()
+		{
+			if(++next_ == length_)
+			{
+				++it_;
+				index_++;
+				fill();
+			}
+
+			return *this;
+		}
+
+		constexpr iterator operator++(int)
+		{
+			iterator before= *this;
+
+			++*this;
+			return before;
+		}
+
+		friend constexpr bool operator==(const iterator& a, sentinel) noexcept
+		{
+			return a.length_ == 0;
+		}
+
+		friend constexpr bool operator!=(const iterator& a, sentinel) noexcept
+		{
+			return a.length_ != 0;
+		}
+
+		friend constexpr bool operator==(sentinel, const iterator& a) noexcept
+		{
+			return a.length_ == 0;
+		}
+
+		friend constexpr bool operator!=(sentinel, const iterator& a) noexcept
+		{
+			return a.length_ != 0;
+		}
+
+	private:
+		/* encodes the code point at it_, or ends the iteration there */
+		constexpr void fill()
+		{
+			int n= 0;
+
+			next_= 0;
+			length_= 0;
+			if(it_ == parent_->last_)
+				return;
+
+			n= codec<Encoding>::encode(bytes_, sizeof(bytes_), (char32_t) *it_);
+			if(n < 0)
+			{
+				parent_->error_= n;
+				parent_->errorIndex_= index_;
+				return;
+			}
+
+			length_= (std::size_t) n;
+		}
+
+		encode_view* parent_= nullptr;
+		Iterator it_= Iterator();
+		unsigned char bytes_[4]= { 0, 0, 0, 0 };
+		std::size_t next_= 0;
+		std::size_t length_= 0;
+		std::size_t index_= 0;
+	};
+
+
+	constexpr encode_view()= default;
+
+	constexpr encode_view(Iterator first, Sentinel last)
+		: first_(first), last_(last)
+	{
+	}
+
+	constexpr iterator begin()
+	{
+		error_= 0;
+		errorIndex_= 0;
+		return iterator(this, first_);
+	}
+
+	constexpr sentinel end() const noexcept
+	{
+		return sentinel();
+	}
+
+	/* 0, or the error code of the code point that stopped the last iteration */
+	constexpr int error() const noexcept
+	{
+		return error_;
+	}
+
+	/* how many code points came before that one */
+	constexpr std::size_t error_index() const noexcept
+	{
+		return errorIndex_;
+	}
+
+private:
+	Iterator first_= Iterator();
+	Sentinel last_= Sentinel();
+	int error_= 0;
+	std::size_t errorIndex_= 0;
+};
+
+
+/* decode_view over len bytes at p */
+template<unsigned int Encoding>
+decode_view<Encoding> decode(const void* p, std::size_t len) noexcept
+{
+	return decode_view<Encoding>(static_cast<const unsigned char*>(p), len);
+}
+
+
+/* encode_view over the code points from first to last */
+template<unsigned int Encoding, class Iterator, class Sentinel>
+constexpr encode_view<Encoding, Iterator, Sentinel> encode(Iterator first, Sentinel last)
+{
+	return encode_view<Encoding, Iterator, Sentinel>(first, last);
+}
+
+
+#if defined(UNICODER_HPP_RANGES)
+
+/* decode_view over a contiguous range of bytes (char, unsigned char, std::byte, a std::span of them...) */
+template<unsigned int Encoding, std::ranges::contiguous_range Range>
+	requires std::ranges::sized_range<Range>  &&  std::ranges::borrowed_range<Range>
+	         &&  (sizeof(std::ranges::range_value_t<Range>) == 1)
+decode_view<Encoding> decode(Range&& bytes) noexcept
+{
+	return decode_view<Encoding>(reinterpret_cast<const unsigned char*>(std::ranges::data(bytes)), std::ranges::size(bytes));
+}
+
+
+/* encode_view over a range of code points */
+template<unsigned int Encoding, std::ranges::input_range Range>
+	requires std::ranges::borrowed_range<Range>
+constexpr encode_view<Encoding, std::ranges::iterator_t<Range>, std::ranges::sentinel_t<Range>> encode(Range&& codePoints)
+{
+	return encode_view<Encoding, std::ranges::iterator_t<Range>, std::ranges::sentinel_t<Range>>(std::ranges::begin(codePoints),
+	                                                                                              std::ranges::end(codePoints));
+}
+
+#endif
+
+
+/*
+Literals.
+
+UNICODER_LITERAL(UNICODER_UTF16LE, u8"Grüße") is a std::array<unsigned char, N> holding the bytes
+of the literal in that encoding, without the terminating zero, worked out by the compiler with
+codec<UNICODER_UTF8>::decode and codec<E>::encode, so a protocol field name or a BOM prefixed
+constant costs nothing at run time and cannot drift from what unicoder_transcode would produce.
+The length is a template argument, which forces the conversion to happen at compile time: a
+literal that is not valid UTF-8, or that holds a code point the encoding cannot take (anything
+past 0x7f for UNICODER_ASCII, or not in the code page), does not compile, and the error names
+detail::literal_is_not_valid_utf8 or detail::literal_does_not_fit_encoding. Assign the result to
+a constexpr variable to keep the bytes themselves out of the run time too. With C++20 the same
+array is unicoder::literal_v<UNICODER_UTF16LE, u8"Grüße">.
+*/
+
+
+namespace detail
+{
+	/* not constexpr, so reaching either one while a literal is converted stops the compiler */
+	inline void literal_is_not_valid_utf8() noexcept
+	{
+	}
+
+
+	inline void literal_does_not_fit_encoding() noexcept
+	{
+	}
+
+
+	/* the code units of a literal as bytes, since codec<UNICODER_UTF8> reads unsigned char */
+	template<class Char, std::size_t N>
+	constexpr void literalBytes(const Char (&text)[N], unsigned char (&bytes)[N]) noexcept
+	{
+		static_assert(sizeof(Char) == 1, "unicoder literals are UTF-8: char, char8_t or unsigned char");
+
+		for(std::size_t i= 0; i < N; i++)
+			bytes[i]= (unsigned char) text[i];
+	}
+}
+
+
+/* bytes the literal text (taken as UTF-8, without its terminating zero) takes in Encoding */
+template<unsigned int Encoding, class Char, std::size_t N>
+constexpr std::size_t literal_length(const Char (&text)[N]) noexcept
+{
+	unsigned char src[N]= {};
+	std::size_t in= 0, out= 0;
+	int bytesRead= 0, bytesWritten= 0;
+	char32_t x= 0;
+
+	detail::literalBytes(text, src);
+	while(in < N - 1)
+	{
+		bytesRead= codec<UNICODER_UTF8>::decode(src + in, N - 1 - in, x);
+		if(bytesRead < 0)
+		{
+			detail::literal_is_not_valid_utf8();
+			return 0;
+		}
+
+		bytesWritten= codec<Encoding>::length(x);
+		if(bytesWritten < 0)
+		{
+			detail::literal_does_not_fit_encoding();
+			return 0;
+		}
+
+		in += bytesRead;
+		out += bytesWritten;
+	}
+
+	return out;
+}
+
+
+/* the literal text in Encoding; Length must be literal_length<Encoding>(text), which */
+/* UNICODER_LITERAL and literal_v fill in */
+template<unsigned int Encoding, std::size_t Length, class Char, std::size_t N>
+constexpr std::array<unsigned char, Length> literal(const Char (&text)[N]) noexcept
+{
+	std::array<unsigned char, Length> bytes= {};
+	unsigned char src[N]= {};
+	std::size_t produced= 0;
+
+	static_assert(Length % codec<Encoding>::unit_size == 0, "literal length is not a whole number of code units");
+
+	detail::literalBytes(text, src);
+	if(transcode<UNICODER_UTF8, Encoding>(src, N - 1, bytes.data(), Length, nullptr, &produced) != 0  ||  produced != Length)
+		detail::literal_does_not_fit_encoding();
+
+	return bytes;
+}
+
+
+#define  UNICODER_LITERAL(encoding, text)                                              \
+	(::unicoder::literal<(encoding), ::unicoder::literal_length<(encoding)>(text)>(text))
+
+
+#if defined(__cpp_nontype_template_args)  &&  __cpp_nontype_template_args >= 201911L
+
+/* a literal as a template argument; the zero at the end is kept, as in the array it came from */
+template<std::size_t N>
+struct literal_text
+{
+	template<class Char>
+	constexpr literal_text(const Char (&text)[N]) noexcept
+	{
+		detail::literalBytes(text, bytes);
+	}
+
+	unsigned char bytes[N]= {};
+};
+
+
+template<class Char, std::size_t N>
+literal_text(const Char (&)[N]) -> literal_text<N>;
+
+
+template<unsigned int Encoding, literal_text Text>
+inline constexpr std::array<unsigned char, literal_length<Encoding>(Text.bytes)> literal_v= literal<Encoding, literal_length<Encoding>(Text.bytes)>(Text.bytes);
+
+#endif
+
+}
+
+
+#endif
@@ -0,0 +1,1055 @@
+/******
+Copyright (C) 2014 Justin Adams
+
+    This file is part of Unicoder.
+
+    Unicoder is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License
+    (version 2.1 only) as published by the Free Software Foundation.
+
+    Unicoder is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with Unicoder.  If not, see <http://www.gnu.org/licenses/>.
+****/
+
+
+/*
+Throughput benchmarks.
+
+Build next to the library with the same flags you ship it with, for example
+
+	cc -O2 unicoder.c unicoder_bench.c -o unicoder_bench -lpthread
+
+and run
+
+	./unicoder_bench                          table on stdout
+	./unicoder_bench -c > run.csv             one csv row per measurement, for keeping track over time
+	UNICODER_CPU=avx2 ./unicoder_bench -c     the same with the kernels held to one tier (scalar, sse4.1,
+	                                          avx2 or avx512)
+
+options:
+	-s KiB   size of each corpus in utf-8 (default 4096)
+	-t secs  minimum time spent on each measurement (default 0.1)
+	-f text  only run measurements whose function name contains text
+	-d dir   where the FILE* benchmarks put their files (default $TMPDIR, or /tmp)
+
+The corpora come from a fixed seed, so runs on the same machine are comparable. GB/s is counted on
+the input side. cycles/cp is time stamp counter ticks per code point on x86 and left out elsewhere.
+Functions that do a fixed amount of work per call (byte order marks, machine endianness) are not measured.
+*/
+
+
+/* clock_gettime and CLOCK_MONOTONIC are POSIX, which a strict -std=c99 build has to ask for */
+#if !defined(_POSIX_C_SOURCE)  &&  !defined(_XOPEN_SOURCE)
+#define  _POSIX_C_SOURCE  199309L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__)  ||  defined(__i386__)
+#include <x86intrin.h>
+#define  BENCH_HAVE_TSC  1
+#endif
+
+#include "unicoder.h"
+
+
+#define  BENCH_ENCODINGS  9
+
+static const char* bench_encodingNames[BENCH_ENCODINGS + 1]=
+{
+	"-", "ascii", "utf8", "utf16be", "utf16le", "utf32be", "utf32le", "8859-1", "8859-15", "cp1252"
+};
+
+
+/* settings from the command line */
+static size_t bench_corpusSize= 4096 * 1024;
+static double bench_minSeconds= 0.1;
+static const char* bench_filter= NULL;
+static const char* bench_dir= NULL;
+static int bench_csv= 0;
+
+
+
+
+
+
+/* one corpus in every encoding it fits in */
+typedef struct
+{
+	const char* name;
+	unsigned int* cps;
+	size_t count;
+	unsigned char* text[BENCH_ENCODINGS + 1]; /* NULL where the corpus cannot be written, as non-ascii in ascii or cyrillic in a code page */
+	size_t len[BENCH_ENCODINGS + 1];
+	unsigned char* damaged; /* the utf-8 text with an ascii byte turned into 0xff every kilobyte or so */
+} bench_corpus;
+
+
+static unsigned int bench_seed;
+
+/* xorshift, so the corpora do not depend on the C library */
+static unsigned int bench_random(unsigned int below)
+{
+	bench_seed ^= bench_seed << 13;
+	bench_seed ^= bench_seed >> 17;
+	bench_seed ^= bench_seed << 5;
+
+	return bench_seed % below;
+}
+
+
+static void bench_put(bench_corpus* c, size_t cap, unsigned int cp)
+{
+	if(c->count < cap)
+		c->cps[c->count++]= cp;
+}
+
+
+static void bench_putAscii(bench_corpus* c, size_t cap, const char* s)
+{
+	while(*s)
+		bench_put(c, cap, (unsigned char) *s++);
+}
+
+
+static const char* bench_words[]=
+{
+	"the", "of", "and", "to", "in", "is", "that", "for", "it", "as", "was", "with", "be", "by", "on",
+	"not", "he", "this", "are", "or", "his", "from", "at", "which", "but", "have", "an", "had", "they",
+	"you", "were", "their", "one", "all", "we", "can", "her", "has", "there", "been", "if", "more"
+};
+
+static const unsigned int bench_latin[]=
+{
+	0xe0, 0xe1, 0xe2, 0xe4, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xee, 0xef, 0xf4, 0xf6, 0xf9, 0xfb, 0xfc, 0xdf, 0xf1
+};
+
+static const char* bench_names[]=
+{
+	"anna", "lars", "\xd0\xb7\xd0\xbe\xd1\x8f", "\xe6\x9d\x8e\xe9\x9b\xb7", "jos\xc3\xa9", "m\xc3\xbcller", "\xce\xbd\xce\xaf\xce\xba\xce\xbf\xcf\x82"
+};
+
+
+/* appends a word: a common english one for kind 0, otherwise random letters of the script for kind */
+static void bench_word(bench_corpus* c, size_t cap, int kind)
+{
+	unsigned int i, n, cp;
+
+	if(kind == 0)
+	{
+		bench_putAscii(c, cap, bench_words[bench_random(sizeof(bench_words) / sizeof(bench_words[0]))]);
+		return;
+	}
+
+	n= 2 + bench_random(7);
+	for(i= 0; i < n; i++)
+	{
+		switch(kind)
+		{
+			case 1:
+				/* latin-1 heavy, about one letter in four accented */
+				if(bench_random(4) == 0)
+					cp= bench_latin[bench_random(sizeof(bench_latin) / sizeof(bench_latin[0]))];
+				else
+					cp= 'a' + bench_random(26);
+				break;
+
+			case 2:
+				cp= 0x0430 + bench_random(32);
+				break;
+
+			default:
+				cp= 0x4e00 + bench_random(0x9fff - 0x4e00);
+				break;
+		};
+
+		bench_put(c, cap, cp);
+	}
+}
+
+
+/* appends a utf-8 string from a constant */
+static void bench_putUtf8(bench_corpus* c, size_t cap, const char* s)
+{
+	unsigned int cp;
+	int n;
+
+	while(*s)
+	{
+		n= unicoder_utf8_decode(&cp, (unsigned char*) s);
+		if(n < 1)
+			break;
+		bench_put(c, cap, cp);
+		s += n;
+	}
+}
+
+
+static void bench_logLine(bench_corpus* c, size_t cap)
+{
+	char line[160];
+	static const char* levels[]= { "INFO ", "DEBUG", "WARN ", "ERROR" };
+
+	sprintf(line, "2024-03-%02u %02u:%02u:%02u.%03u %s [worker-%u] id=%08x user=",
+	        1 + bench_random(28), bench_random(24), bench_random(60), bench_random(60), bench_random(1000),
+	        levels[bench_random(4)], bench_random(16), bench_random(0x7fffffff));
+	bench_putAscii(c, cap, line);
+	bench_putUtf8(c, cap, bench_names[bench_random(sizeof(bench_names) / sizeof(bench_names[0]))]);
+
+	sprintf(line, " path=/api/v1/items/%u status=%u ms=%u msg=\"", bench_random(100000), 200 + 100 * bench_random(4), bench_random(2000));
+	bench_putAscii(c, cap, line);
+	bench_word(c, cap, 0);
+	bench_put(c, cap, ' ');
+	bench_word(c, cap, 0);
+
+	if(bench_random(5) == 0)
+	{
+		bench_put(c, cap, ' ');
+		bench_put(c, cap, 0x1f600 + bench_random(0x50));
+	}
+
+	bench_putAscii(c, cap, "\"\n");
+}
+
+
+/* kind: 0 ascii, 1 latin-1 heavy, 2 cyrillic, 3 cjk, 4 emoji heavy, 5 log lines */
+static void bench_generate(bench_corpus* c, int kind)
+{
+	static const char* names[]= { "ascii", "latin", "cyrillic", "cjk", "emoji", "logs" };
+	size_t cap, utf8Len, i;
+	unsigned int e;
+	int ret;
+
+	c->name= names[kind];
+	bench_seed= 2463534242u + (unsigned int) kind;
+
+	/* every code point is at least one byte of utf-8, so this is enough */
+	cap= bench_corpusSize;
+	c->cps= (unsigned int*) malloc(cap * sizeof(unsigned int));
+	c->count= 0;
+
+	utf8Len= 0;
+	while(utf8Len < bench_corpusSize  &&  c->count < cap)
+	{
+		i= c->count;
+
+		if(kind == 5)
+			bench_logLine(c, cap);
+
+		else if(kind == 4)
+		{
+			if(bench_random(3) == 0)
+				bench_put(c, cap, 0x1f300 + bench_random(0x1faff - 0x1f300));
+			else
+				bench_word(c, cap, 0);
+			bench_put(c, cap, ' ');
+		}
+
+		else
+		{
+			bench_word(c, cap, kind);
+			bench_put(c, cap, (bench_random(12) == 0) ? '\n' : ((kind == 3) ? 0x3002 : ' '));
+		}
+
+		for(; i < c->count; i++)
+			utf8Len += 1 + (c->cps[i] > 0x7f) + (c->cps[i] > 0x7ff) + (c->cps[i] > 0xffff);
+	}
+
+	/* utf-32le by hand, then everything else through the library */
+	c->text[UNICODER_UTF32LE]= (unsigned char*) malloc(c->count * 4 + 64);
+	for(i= 0; i < c->count; i++)
+		unicoder_writeCodePoint(c->text[UNICODER_UTF32LE] + 4 * i, c->cps[i], UNICODER_UTF32LE);
+	c->len[UNICODER_UTF32LE]= c->count * 4;
+
+	for(e= UNICODER_ASCII; e <= UNICODER_CP1252; e++)
+	{
+		if(e == UNICODER_UTF32LE)
+			continue;
+
+		/* 64 bytes of zero padding, the single code point decoders read past the end */
+		c->text[e]= (unsigned char*) calloc(c->count * 4 + 64, 1);
+		ret= unicoder_transcode(c->text[UNICODER_UTF32LE], c->len[UNICODER_UTF32LE], UNICODER_UTF32LE,
+		                        c->text[e], c->count * 4, e, NULL, &c->len[e]);
+		if(ret != 0)
+		{
+			free(c->text[e]);
+			c->text[e]= NULL;
+			c->len[e]= 0;
+		}
+	}
+
+	/* only ascii bytes are hit, so one U+FFFD in place of each keeps the output within the buffers */
+	c->damaged= (unsigned char*) malloc(c->len[UNICODER_UTF8] + 64);
+	memcpy(c->damaged, c->text[UNICODER_UTF8], c->len[UNICODER_UTF8] + 64);
+	for(i= bench_random(2048); i < c->len[UNICODER_UTF8]; i += 1 + bench_random(2048))
+	{
+		while(i < c->len[UNICODER_UTF8]  &&  c->damaged[i] > 0x7f)
+			i++;
+		if(i < c->len[UNICODER_UTF8])
+			c->damaged[i]= 0xff;
+	}
+}
+
+
+static void bench_free(bench_corpus* c)
+{
+	unsigned int e;
+
+	for(e= UNICODER_ASCII; e <= UNICODER_CP1252; e++)
+		free(c->text[e]);
+	free(c->damaged);
+	free(c->cps);
+}
+
+
+
+
+
+
+/* what every measured function gets */
+typedef struct
+{
+	const bench_corpus* corpus;
+	unsigned int src, dst;
+	unsigned char* out;
+	size_t outCap;
+	FILE* file;
+	char inPath[512], outPath[512];
+	unsigned long long sink; /* results go here so the compiler cannot drop the work */
+} bench_args;
+
+typedef void (*bench_fn)(bench_args* a);
+
+
+static double bench_now(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (double) t.tv_sec + (double) t.tv_nsec * 1e-9;
+}
+
+
+static unsigned long long bench_ticks(void)
+{
+#if defined(BENCH_HAVE_TSC)
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+
+static int bench_wanted(const char* function)
+{
+	return bench_filter == NULL  ||  strstr(function, bench_filter) != NULL;
+}
+
+
+/* runs fn until bench_minSeconds have gone by, and reports the fastest run */
+static void bench_run(const char* function, bench_fn fn, bench_args* a, size_t bytes, size_t codePoints)
+{
+	double start, t, best= 1e30, spent= 0;
+	unsigned long long ticks, bestTicks= 0;
+	int runs= 0;
+
+	if(!bench_wanted(function))
+		return;
+
+	while(spent < bench_minSeconds  ||  runs < 3)
+	{
+		ticks= bench_ticks();
+		start= bench_now();
+		fn(a);
+		t= bench_now() - start;
+		ticks= bench_ticks() - ticks;
+
+		if(t < best)
+		{
+			best= t;
+			bestTicks= ticks;
+		}
+
+		spent += t;
+		runs++;
+	}
+
+	if(best <= 0)
+		best= 1e-9;
+
+	if(bench_csv)
+	{
+		printf("%s,%s,%s,%s,%lu,%lu,%.9f,%.4f,", a->corpus->name, function,
+		       bench_encodingNames[a->src], bench_encodingNames[a->dst],
+		       (unsigned long) bytes, (unsigned long) codePoints, best, (double) bytes / best / 1e9);
+#if defined(BENCH_HAVE_TSC)
+		printf("%.3f\n", (double) bestTicks / (double) codePoints);
+#else
+		printf("\n");
+#endif
+	}
+
+	else
+	{
+		printf("%-9s %-34s %-8s %-8s %9.3f GB/s", a->corpus->name, function,
+		       bench_encodingNames[a->src], bench_encodingNames[a->dst], (double) bytes / best / 1e9);
+#if defined(BENCH_HAVE_TSC)
+		printf(" %9.2f cycles/cp", (double) bestTicks / (double) codePoints);
+#endif
+		printf("\n");
+	}
+
+	fflush(stdout);
+}
+
+
+
+
+
+
+/* buffer APIs */
+
+static void bench_transcode(bench_args* a)
+{
+	size_t produced;
+
+	unicoder_transcode(a->corpus->text[a->src], a->corpus->len[a->src], a->src, a->out, a->outCap, a->dst, NULL, &produced);
+	a->sink += produced;
+}
+
+
+static void bench_transcodeParallel(bench_args* a)
+{
+	size_t produced;
+
+	unicoder_transcodeParallel(a->corpus->text[a->src], a->corpus->len[a->src], a->src,
+	                           a->out, a->outCap, a->dst, NULL, &produced, 0);
+	a->sink += produced;
+}
+
+
+/* the damaged utf-8, every bad byte dealt with by policy */
+static void bench_transcodeLossy(bench_args* a, unsigned int policy)
+{
+	size_t produced, errors;
+
+	unicoder_transcodeLossy(a->corpus->damaged, a->corpus->len[UNICODER_UTF8], UNICODER_UTF8, a->out, a->outCap, a->dst,
+	                        policy, NULL, 0, &errors, NULL, &produced);
+	a->sink += produced + errors;
+}
+
+
+static void bench_transcodeLossyReplace(bench_args* a)
+{
+	bench_transcodeLossy(a, UNICODER_POLICY_REPLACE);
+}
+
+
+static void bench_transcodeLossySkip(bench_args* a)
+{
+	bench_transcodeLossy(a, UNICODER_POLICY_SKIP);
+}
+
+
+/* the copy that puts the source back in out is timed too, it costs little next to the conversion */
+static void bench_transcodeInPlace(bench_args* a)
+{
+	size_t newLen;
+
+	memcpy(a->out, a->corpus->text[a->src], a->corpus->len[a->src]);
+	unicoder_transcodeInPlace(a->out, a->corpus->len[a->src], a->src, a->dst, &newLen);
+	a->sink += newLen;
+}
+
+
+static void bench_transcodedLength(bench_args* a)
+{
+	size_t length;
+
+	unicoder_transcodedLength(a->corpus->text[a->src], a->corpus->len[a->src], a->src, a->dst, &length);
+	a->sink += length;
+}
+
+
+static void bench_countCodePoints(bench_args* a)
+{
+	size_t count;
+
+	unicoder_countCodePoints(a->corpus->text[a->src], a->corpus->len[a->src], a->src, &count);
+	a->sink += count;
+}
+
+
+static void bench_validate(bench_args* a)
+{
+	size_t offset;
+
+	unicoder_utf8_validate(a->corpus->text[a->src], a->corpus->len[a->src], &offset);
+	a->sink += offset;
+}
+
+
+static void bench_detectEncoding(bench_args* a)
+{
+	a->sink += unicoder_detectEncoding(a->corpus->text[a->src], a->corpus->len[a->src], a->corpus->len[a->src], NULL);
+}
+
+
+static void bench_nfcQuickCheck(bench_args* a)
+{
+	a->sink += unicoder_nfcQuickCheck(a->corpus->text[a->src], a->corpus->len[a->src], a->src);
+}
+
+
+static void bench_caseFold(bench_args* a)
+{
+	size_t produced;
+
+	unicoder_caseFold(a->corpus->text[a->src], a->corpus->len[a->src], a->src, a->out, a->outCap, NULL, &produced);
+	a->sink += produced;
+}
+
+
+static void bench_index(bench_args* a)
+{
+	unicoder_index* ix;
+	size_t codePoints;
+
+	ix= unicoder_index_open(a->src, 0);
+	unicoder_index_append(ix, a->corpus->text[a->src], a->corpus->len[a->src]);
+	unicoder_index_length(ix, &codePoints, NULL);
+	unicoder_index_close(ix);
+	a->sink += codePoints;
+}
+
+
+static void bench_split(bench_args* a)
+{
+	unicoder_splitter s;
+	const unsigned char* record;
+	size_t recordLen;
+
+	unicoder_splitter_init(&s, a->corpus->text[a->src], a->corpus->len[a->src], a->src, UNICODER_LINES);
+	while(unicoder_splitter_next(&s, &record, &recordLen) == 0)
+		a->sink += recordLen;
+}
+
+
+static void bench_swapByteOrder(bench_args* a)
+{
+	unicoder_swapByteOrder(a->corpus->text[a->src], a->out, a->corpus->len[a->src], (a->src <= UNICODER_UTF16LE) ? 2 : 4);
+	a->sink += a->out[0];
+}
+
+
+static void bench_reverseEndianness(bench_args* a)
+{
+	const unsigned char* p= a->corpus->text[a->src];
+	size_t i;
+
+	for(i= 0; i < a->corpus->len[a->src]; i += 4)
+		unicoder_reverseEndianness((unsigned char*) p + i, a->out + i, 4);
+	a->sink += a->out[0];
+}
+
+
+static void bench_reverseByteEndian(bench_args* a)
+{
+	const unsigned int* cps= a->corpus->cps;
+	size_t i;
+
+	for(i= 0; i < a->corpus->count; i++)
+		a->sink += unicoder_uint32_reverseByteEndian(cps[i]);
+}
+
+
+/* chunks about the size of a network packet */
+static void bench_decoder(bench_args* a)
+{
+	unicoder_decoder d;
+	size_t in= 0, out= 0, chunk, consumed, produced;
+
+	unicoder_decoder_init(&d, a->src, a->dst);
+	while(in < a->corpus->len[a->src])
+	{
+		chunk= a->corpus->len[a->src] - in;
+		if(chunk > 1447)
+			chunk= 1447;
+
+		unicoder_decoder_decode(&d, a->corpus->text[a->src] + in, chunk, a->out + out, a->outCap - out, &consumed, &produced);
+		in += chunk;
+		out += produced;
+	}
+
+	a->sink += out + unicoder_decoder_finish(&d);
+}
+
+
+static void bench_readCodePoint(bench_args* a)
+{
+	unsigned char* p= a->corpus->text[a->src];
+	unsigned char* end= p + a->corpus->len[a->src];
+	unsigned int x;
+	int n;
+
+	while(p < end)
+	{
+		n= unicoder_readCodePoint(p, &x, a->src);
+		if(n < 1)
+			break;
+		p += n;
+		a->sink += x;
+	}
+}
+
+
+static void bench_decode(bench_args* a)
+{
+	unsigned char* p= a->corpus->text[a->src];
+	unsigned char* end= p + a->corpus->len[a->src];
+	unsigned int x;
+	int n;
+
+	while(p < end)
+	{
+		if(a->src == UNICODER_UTF8)
+			n= unicoder_utf8_decode(&x, p);
+		else if(a->src == UNICODER_UTF16LE)
+			n= unicoder_utf16_decode(&x, p, UNICODER_LES);
+		else
+			n= unicoder_utf32_decode(&x, p, UNICODER_LES);
+
+		if(n < 1)
+			break;
+		p += n;
+		a->sink += x;
+	}
+}
+
+
+static void bench_writeCodePoint(bench_args* a)
+{
+	size_t i, out= 0;
+	int n;
+
+	for(i= 0; i < a->corpus->count; i++)
+	{
+		n= unicoder_writeCodePoint(a->out + out, a->corpus->cps[i], a->dst);
+		if(n < 1)
+			break;
+		out += n;
+	}
+
+	a->sink += out;
+}
+
+
+static void bench_encode(bench_args* a)
+{
+	size_t i, out= 0;
+	int n;
+
+	for(i= 0; i < a->corpus->count; i++)
+	{
+		if(a->dst == UNICODER_UTF8)
+			n= unicoder_utf8_encode(a->out + out, a->corpus->cps[i]);
+		else if(a->dst == UNICODER_UTF16LE)
+			n= unicoder_utf16_encode(a->out + out, a->corpus->cps[i], UNICODER_LES);
+		else
+			n= unicoder_utf32_encode(a->out + out, a->corpus->cps[i], UNICODER_LES);
+
+		if(n < 1)
+			break;
+		out += n;
+	}
+
+	a->sink += out;
+}
+
+
+
+
+
+
+/* FILE* APIs, all working on files in bench_dir that the page cache keeps warm */
+
+/* the old per code point reader is far slower than everything else, so it only gets this much */
+#define  BENCH_SLOW_FILE_LIMIT  (256 * 1024)
+
+static void bench_readCodePointFromFile(bench_args* a)
+{
+	unsigned int x;
+	long limit= BENCH_SLOW_FILE_LIMIT;
+
+	rewind(a->file);
+	while(ftell(a->file) < limit  &&  unicoder_readCodePointFromFile(a->file, &x, a->src) > 0)
+		a->sink += x;
+}
+
+
+static void bench_writeCodePointToFile(bench_args* a)
+{
+	size_t i;
+
+	rewind(a->file);
+	for(i= 0; i < a->corpus->count; i++)
+		unicoder_writeCodePointToFile(a->file, a->corpus->cps[i], a->dst);
+	fflush(a->file);
+}
+
+
+static void bench_writeCStringToFile(bench_args* a)
+{
+	char* s= (char*) a->out;
+	size_t i, n;
+
+	/* it takes up to a million chars at a time */
+	rewind(a->file);
+	for(i= 0; i < a->corpus->len[UNICODER_ASCII]; i += n)
+	{
+		n= a->corpus->len[UNICODER_ASCII] - i;
+		if(n > 1000000)
+			n= 1000000;
+		memcpy(s, a->corpus->text[UNICODER_ASCII] + i, n);
+		s[n]= 0;
+		a->sink += unicoder_writeCStringToFile(a->file, s, a->dst);
+	}
+	fflush(a->file);
+}
+
+
+static void bench_readerReadCodePoint(bench_args* a)
+{
+	unicoder_reader* r;
+	unsigned int x;
+
+	rewind(a->file);
+	r= unicoder_reader_open(a->file, a->src);
+	while(unicoder_reader_readCodePoint(r, &x) > 0)
+		a->sink += x;
+	unicoder_reader_close(r);
+}
+
+
+static void bench_readerRead(bench_args* a)
+{
+	unicoder_reader* r;
+	size_t produced;
+
+	rewind(a->file);
+	r= unicoder_reader_open(a->file, a->src);
+	while(unicoder_reader_read(r, a->out, a->outCap, a->dst, &produced) == 0)
+		a->sink += produced;
+	unicoder_reader_close(r);
+}
+
+
+static void bench_readerReadRecord(bench_args* a)
+{
+	unicoder_reader* r;
+	const unsigned char* record;
+	size_t recordLen;
+
+	rewind(a->file);
+	r= unicoder_reader_open(a->file, a->src);
+	while(unicoder_reader_readRecord(r, UNICODER_LINES, &record, &recordLen) == 0)
+		a->sink += recordLen;
+	unicoder_reader_close(r);
+}
+
+
+static void bench_writerWriteCodePoint(bench_args* a)
+{
+	unicoder_writer* w;
+	size_t i;
+
+	rewind(a->file);
+	w= unicoder_writer_open(a->file, a->dst, 0);
+	for(i= 0; i < a->corpus->count; i++)
+		unicoder_writer_writeCodePoint(w, a->corpus->cps[i]);
+	unicoder_writer_close(w);
+	fflush(a->file);
+}
+
+
+static void bench_writerWrite(bench_args* a)
+{
+	unicoder_writer* w;
+
+	rewind(a->file);
+	w= unicoder_writer_open(a->file, a->dst, 0);
+	unicoder_writer_write(w, a->corpus->text[a->src], a->corpus->len[a->src], a->src, NULL);
+	unicoder_writer_close(w);
+	fflush(a->file);
+}
+
+
+static void bench_transcodeFile(bench_args* a)
+{
+	unicoder_fileStats stats;
+
+	unicoder_transcodeFile(a->inPath, a->outPath, a->dst, &stats);
+	a->sink += stats.bytesWritten;
+}
+
+
+static void bench_detectEncodingFromFile(bench_args* a)
+{
+	rewind(a->file);
+	a->sink += unicoder_detectEncodingFromFile(a->file, a->corpus->len[a->src], NULL);
+}
+
+
+/* writes the corpus in encoding to inPath (with a byte order mark if bom) and opens it for reading into a->file */
+static int bench_openInput(bench_args* a, unsigned int encoding, int bom)
+{
+	FILE* f;
+
+	f= fopen(a->inPath, "wb");
+	if(f == NULL)
+		return 0;
+
+	if(bom)
+		unicoder_writeBomToFile(f, encoding);
+	fwrite(a->corpus->text[encoding], 1, a->corpus->len[encoding], f);
+	fclose(f);
+
+	a->file= fopen(a->inPath, "rb");
+	return a->file != NULL;
+}
+
+
+static int bench_openOutput(bench_args* a)
+{
+	a->file= fopen(a->outPath, "w+b");
+	return a->file != NULL;
+}
+
+
+static void bench_close(bench_args* a)
+{
+	if(a->file != NULL)
+		fclose(a->file);
+	a->file= NULL;
+}
+
+
+
+
+
+
+static void bench_corpusSuite(const bench_corpus* c)
+{
+	bench_args a;
+	unsigned int s, d;
+	size_t bytes;
+	static const unsigned int wide[]= { UNICODER_UTF8, UNICODER_UTF16LE, UNICODER_UTF32LE };
+
+	memset(&a, 0, sizeof(a));
+	a.corpus= c;
+	a.outCap= c->count * 4 + 64;
+	a.out= (unsigned char*) malloc(a.outCap + 1000001);
+	sprintf(a.inPath, "%s/unicoder_bench_in.tmp", bench_dir);
+	sprintf(a.outPath, "%s/unicoder_bench_out.tmp", bench_dir);
+
+	/* every pair the corpus fits in, through the bulk api */
+	for(s= UNICODER_ASCII; s <= UNICODER_CP1252; s++)
+	{
+		for(d= UNICODER_ASCII; d <= UNICODER_CP1252; d++)
+		{
+			if(c->text[s] == NULL  ||  c->text[d] == NULL)
+				continue;
+			a.src= s;
+			a.dst= d;
+			bench_run("unicoder_transcode", bench_transcode, &a, c->len[s], c->count);
+		}
+	}
+
+	/* the same from utf-8 with errors mixed in */
+	a.src= UNICODER_UTF8;
+	for(d= 0; d < 3; d++)
+	{
+		a.dst= wide[d];
+		bench_run("unicoder_transcodeLossy/replace", bench_transcodeLossyReplace, &a, c->len[a.src], c->count);
+		bench_run("unicoder_transcodeLossy/skip", bench_transcodeLossySkip, &a, c->len[a.src], c->count);
+	}
+
+	/* in place, a pair that can grow and has to be checked first and one that only ever shrinks */
+	/* the first is left out where the output would overtake the input, as with cjk, since it */
+	/* returns at once there */
+	for(s= 0; s < 2; s++)
+	{
+		a.src= (s == 0) ? UNICODER_UTF16LE : UNICODER_UTF32LE;
+		a.dst= UNICODER_UTF8;
+		memcpy(a.out, c->text[a.src], c->len[a.src]);
+		if(unicoder_transcodeInPlace(a.out, c->len[a.src], a.src, a.dst, NULL) == 0)
+			bench_run("unicoder_transcodeInPlace", bench_transcodeInPlace, &a, c->len[a.src], c->count);
+	}
+
+	for(s= 0; s < 3; s++)
+	{
+		for(d= 0; d < 3; d++)
+		{
+			if(s == d)
+				continue;
+			a.src= wide[s];
+			a.dst= wide[d];
+			bench_run("unicoder_transcodeParallel", bench_transcodeParallel, &a, c->len[a.src], c->count);
+			bench_run("unicoder_transcodedLength", bench_transcodedLength, &a, c->len[a.src], c->count);
+			bench_run("unicoder_decoder_decode", bench_decoder, &a, c->len[a.src], c->count);
+		}
+
+		a.src= wide[s];
+		a.dst= 0;
+		bench_run("unicoder_countCodePoints", bench_countCodePoints, &a, c->len[a.src], c->count);
+		bench_run("unicoder_detectEncoding", bench_detectEncoding, &a, c->len[a.src], c->count);
+		bench_run("unicoder_nfcQuickCheck", bench_nfcQuickCheck, &a, c->len[a.src], c->count);
+		bench_run("unicoder_caseFold", bench_caseFold, &a, c->len[a.src], c->count);
+		bench_run("unicoder_index_append", bench_index, &a, c->len[a.src], c->count);
+		bench_run("unicoder_splitter_next", bench_split, &a, c->len[a.src], c->count);
+		bench_run("unicoder_readCodePoint", bench_readCodePoint, &a, c->len[a.src], c->count);
+
+		a.src= 0;
+		a.dst= wide[s];
+		bench_run("unicoder_writeCodePoint", bench_writeCodePoint, &a, c->count * 4, c->count);
+	}
+
+	a.src= UNICODER_UTF8;
+	a.dst= 0;
+	bench_run("unicoder_utf8_validate", bench_validate, &a, c->len[a.src], c->count);
+	bench_run("unicoder_utf8_decode", bench_decode, &a, c->len[a.src], c->count);
+	a.src= UNICODER_UTF16LE;
+	bench_run("unicoder_utf16_decode", bench_decode, &a, c->len[a.src], c->count);
+	bench_run("unicoder_swapByteOrder", bench_swapByteOrder, &a, c->len[a.src], c->count);
+	a.src= UNICODER_UTF32LE;
+	bench_run("unicoder_utf32_decode", bench_decode, &a, c->len[a.src], c->count);
+	bench_run("unicoder_swapByteOrder", bench_swapByteOrder, &a, c->len[a.src], c->count);
+	bench_run("unicoder_reverseEndianness", bench_reverseEndianness, &a, c->len[a.src], c->count);
+	bench_run("unicoder_uint32_reverseByteEndian", bench_reverseByteEndian, &a, c->count * 4, c->count);
+
+	a.src= 0;
+	for(d= 0; d < 3; d++)
+	{
+		a.dst= wide[d];
+		bench_run((d == 0) ? "unicoder_utf8_encode" : ((d == 1) ? "unicoder_utf16_encode" : "unicoder_utf32_encode"),
+		          bench_encode, &a, c->count * 4, c->count);
+	}
+
+	/* FILE* apis */
+	for(s= 0; s < 3; s++)
+	{
+		a.src= wide[s];
+		a.dst= 0;
+
+		if(bench_openInput(&a, a.src, 0))
+		{
+			bytes= (c->len[a.src] < BENCH_SLOW_FILE_LIMIT) ? c->len[a.src] : BENCH_SLOW_FILE_LIMIT;
+			bench_run("unicoder_readCodePointFromFile", bench_readCodePointFromFile, &a, bytes,
+			          (size_t) ((double) c->count * bytes / c->len[a.src]));
+			bench_run("unicoder_reader_readCodePoint", bench_readerReadCodePoint, &a, c->len[a.src], c->count);
+			bench_run("unicoder_reader_readRecord", bench_readerReadRecord, &a, c->len[a.src], c->count);
+			bench_run("unicoder_detectEncodingFromFile", bench_detectEncodingFromFile, &a, c->len[a.src], c->count);
+
+			for(d= 0; d < 3; d++)
+			{
+				a.dst= wide[d];
+				bench_run("unicoder_reader_read", bench_readerRead, &a, c->len[a.src], c->count);
+			}
+			bench_close(&a);
+		}
+
+		/* transcodeFile goes by the byte order mark */
+		if(bench_openInput(&a, a.src, 1))
+		{
+			bench_close(&a);
+			for(d= 0; d < 3; d++)
+			{
+				a.dst= wide[d];
+				bench_run("unicoder_transcodeFile", bench_transcodeFile, &a, c->len[a.src], c->count);
+			}
+		}
+
+		a.dst= a.src;
+		if(bench_openOutput(&a))
+		{
+			a.src= 0;
+			bench_run("unicoder_writeCodePointToFile", bench_writeCodePointToFile, &a, c->count * 4, c->count);
+			bench_run("unicoder_writer_writeCodePoint", bench_writerWriteCodePoint, &a, c->count * 4, c->count);
+
+			for(d= 0; d < 3; d++)
+			{
+				a.src= wide[d];
+				bench_run("unicoder_writer_write", bench_writerWrite, &a, c->len[a.src], c->count);
+			}
+
+			if(c->text[UNICODER_ASCII] != NULL)
+			{
+				a.src= UNICODER_ASCII;
+				bench_run("unicoder_writeCStringToFile", bench_writeCStringToFile, &a, c->len[a.src], c->count);
+			}
+			bench_close(&a);
+		}
+	}
+
+	remove(a.inPath);
+	remove(a.outPath);
+
+	if(a.sink == 42)
+		fprintf(stderr, "\n");
+
+	free(a.out);
+}
+
+
+int main(int argc, char** argv)
+{
+	bench_corpus c;
+	int i, kind;
+
+	bench_dir= getenv("TMPDIR");
+	if(bench_dir == NULL  ||  *bench_dir == 0)
+		bench_dir= "/tmp";
+
+	for(i= 1; i < argc; i++)
+	{
+		if(strcmp(argv[i], "-c") == 0)
+			bench_csv= 1;
+		else if(strcmp(argv[i], "-s") == 0  &&  i + 1 < argc)
+			bench_corpusSize= (size_t) strtoul(argv[++i], NULL, 10) * 1024;
+		else if(strcmp(argv[i], "-t") == 0  &&  i + 1 < argc)
+			bench_minSeconds= atof(argv[++i]);
+		else if(strcmp(argv[i], "-f") == 0  &&  i + 1 < argc)
+			bench_filter= argv[++i];
+		else if(strcmp(argv[i], "-d") == 0  &&  i + 1 < argc)
+			bench_dir= argv[++i];
+		else
+		{
+			fprintf(stderr, "usage: %s [-c] [-s KiB] [-t seconds] [-f function] [-d dir]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	if(bench_corpusSize == 0)
+		bench_corpusSize= 1024;
+
+	if(bench_csv)
+		printf("corpus,function,src,dst,bytes,code_points,seconds,gb_per_s,cycles_per_cp\n");
+
+	for(kind= 0; kind < 6; kind++)
+	{
+		memset(&c, 0, sizeof(c));
+		bench_generate(&c, kind);
+		bench_corpusSuite(&c);
+		bench_free(&c);
+	}
+
+	return 0;
+}
@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+
+######
+# Copyright (C) 2014 Justin Adams
+#
+#     This file is part of Unicoder.
+#
+#     Unicoder is free software: you can redistribute it and/or modify
+#     it under the terms of the GNU Lesser General Public License
+#     (version 2.1 only) as published by the Free Software Foundation.
+#
+#     Unicoder is distributed in the hope that it will be useful,
+#     but WITHOUT ANY WARRANTY; without even the implied warranty of
+#     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#     GNU Lesser General Public License for more details.
+#
+#     You should have received a copy of the GNU Lesser General Public License
+#     along with Unicoder.  If not, see <http://www.gnu.org/licenses/>.
+######
+
+
+"""
+Writes unicoder_tables.h, the character property tables unicoder.c includes.
+
+	python3 unicoder_tables.py > unicoder_tables.h
+
+The properties come from the unicodedata module, so the tables follow the unicode version of the
+python that runs this; the version ends up in UNICODER_UNICODE_VERSION.
+
+Every code point gets a (general category, canonical combining class, nfc quick check) triple.
+There are only about a hundred different triples, so the code points map to a triple number
+through two stages: the high bits of the code point pick a block, the low bits an entry in it,
+and identical blocks are stored once. The block size is whichever makes the tables smallest.
+
+Simple case folding goes the same way, with the difference between a code point and its folding
+in place of the triple.
+"""
+
+
+import sys
+import unicodedata
+
+
+# order of the UNICODER_CATEGORY_ constants in unicoder.h, Cn first so unassigned code points are 0
+CATEGORIES= ["Cn", "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd", "Nl", "No", "Pc", "Pd", "Ps",
+             "Pe", "Pi", "Pf", "Po", "Sm", "Sc", "Sk", "So", "Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co"]
+
+# UNICODER_NFC_YES, UNICODER_NFC_NO and UNICODER_NFC_MAYBE
+NFC_YES, NFC_NO, NFC_MAYBE= 0, 1, 2
+
+CODE_POINTS= 0x110000
+
+
+def nfcQuickCheck():
+	"""
+	unicodedata has no NFC_Quick_Check, but it follows from what it does have: No is exactly the
+	code points nfc does not leave alone (the full composition exclusions), and Maybe the ones that
+	come second in a canonical pair something composes to, plus the hangul vowel and trailing jamo
+	"""
+	no= set()
+	maybe= set(range(0x1161, 0x1176)) | set(range(0x11a8, 0x11c3))
+
+	for x in range(CODE_POINTS):
+		if 0xd800 <= x <= 0xdfff:
+			continue
+
+		c= chr(x)
+		if unicodedata.normalize("NFC", c) != c:
+			no.add(x)
+			continue
+
+		decomposition= unicodedata.decomposition(c).split()
+		if len(decomposition) == 2  and  not decomposition[0].startswith("<"):
+			maybe.add(int(decomposition[1], 16))
+
+	return no, maybe
+
+
+def properties():
+	no, maybe= nfcQuickCheck()
+	triples= []
+
+	for x in range(CODE_POINTS):
+		c= chr(x)
+
+		if x in no:
+			quickCheck= NFC_NO
+		elif x in maybe:
+			quickCheck= NFC_MAYBE
+		else:
+			quickCheck= NFC_YES
+
+		triples.append((CATEGORIES.index(unicodedata.category(c)), unicodedata.combining(c), quickCheck))
+
+	return triples
+
+
+def simpleFolding(x):
+	"""
+	CaseFolding.txt status C and S: str.casefold() is C plus F, so where it gives one code point
+	that is C, and where it gives more (F) the S entry, if there is one, is the lowercase letter
+	"""
+	c= chr(x)
+
+	folded= c.casefold()
+	if len(folded) == 1:
+		return ord(folded)
+
+	lower= c.lower()
+	if len(lower) == 1:
+		return ord(lower)
+
+	return x
+
+
+def foldDeltas():
+	deltas= []
+
+	for x in range(CODE_POINTS):
+		if 0xd800 <= x <= 0xdfff:
+			deltas.append(0)
+			continue
+
+		folded= simpleFolding(x)
+
+		# unicoder_caseFold relies on this to fold utf-16 in place
+		assert (x > 0xffff) == (folded > 0xffff)
+
+		deltas.append(folded - x)
+
+	return deltas
+
+
+def split(values, shift):
+	"""values cut into blocks of 1 << shift, returns the block number of each piece and the distinct blocks"""
+	size= 1 << shift
+	numbers= {}
+	blocks= []
+	index= []
+
+	for i in range(0, len(values), size):
+		block= tuple(values[i:i + size])
+		if block not in numbers:
+			numbers[block]= len(blocks)
+			blocks.append(block)
+		index.append(numbers[block])
+
+	return index, blocks
+
+
+def typeFor(count):
+	return "unsigned char" if count <= 0x100 else "unsigned short"
+
+
+def tableSize(index, blocks, shift):
+	return len(index) * (1 if len(blocks) <= 0x100 else 2) + (len(blocks) << shift)
+
+
+def writeArray(out, declaration, values, width):
+	out.write(declaration + "=\n{\n")
+
+	for i in range(0, len(values), width):
+		line= ", ".join("%3d" % v for v in values[i:i + width])
+		out.write("\t" + line + ("," if i + width < len(values) else "") + "\n")
+
+	out.write("};\n")
+
+
+def twoStage(values):
+	"""the block size that makes the tables smallest, returns the shift, the block of each piece and the blocks"""
+	best= None
+
+	for shift in range(4, 11):
+		index, blocks= split(values, shift)
+		size= tableSize(index, blocks, shift)
+		if best is None  or  size < best[0]:
+			best= (size, shift, index, blocks)
+
+	return best
+
+
+def main():
+	triples= properties()
+
+	# the all zero triple first, that is what unassigned code points and anything past 0x10ffff get
+	distinct= sorted(set(triples))
+	number= {t: i for i, t in enumerate(distinct)}
+	size, shift, index, blocks= twoStage([number[t] for t in triples])
+
+	# no folding first, for the same reason
+	deltas= foldDeltas()
+	distinctDeltas= sorted(set(deltas), key= lambda d: (d != 0, d))
+	deltaNumber= {d: i for i, d in enumerate(distinctDeltas)}
+	foldSize, foldShift, foldIndex, foldBlocks= twoStage([deltaNumber[d] for d in deltas])
+
+	out= sys.stdout
+
+	out.write("/* generated by unicoder_tables.py from unicode %s, do not edit, only unicoder.c includes this */\n\n\n"
+	          % unicodedata.unidata_version)
+
+	out.write("#define  UNICODER_UNICODE_VERSION  \"%s\"\n" % unicodedata.unidata_version)
+	out.write("#define  UNICODER_PROPERTY_SHIFT   %d\n" % shift)
+	out.write("#define  UNICODER_FOLD_SHIFT       %d\n\n\n" % foldShift)
+
+	out.write("/* %d distinct properties, %d blocks of %d code points, %d bytes of tables */\n\n"
+	          % (len(distinct), len(blocks), 1 << shift, size + 3 * len(distinct)))
+
+	out.write("/* { general category, canonical combining class, nfc quick check } */\n")
+	out.write("static const unicoder_property unicoder_properties[%d]=\n{\n" % len(distinct))
+	for i, (category, combiningClass, quickCheck) in enumerate(distinct):
+		out.write("\t{ %2d, %3d, %d }%s /* %s */\n"
+		          % (category, combiningClass, quickCheck, "," if i + 1 < len(distinct) else " ", CATEGORIES[category]))
+	out.write("};\n\n\n")
+
+	out.write("/* block of each code point >> UNICODER_PROPERTY_SHIFT */\n")
+	writeArray(out, "static const %s unicoder_propertyBlocks[%d]" % (typeFor(len(blocks)), len(index)), index, 16)
+	out.write("\n\n")
+
+	out.write("/* property number of each code point in a block */\n")
+	writeArray(out, "static const %s unicoder_propertyIndex[%d << UNICODER_PROPERTY_SHIFT]" % (typeFor(len(distinct)), len(blocks)),
+	           [v for block in blocks for v in block], 16)
+	out.write("\n\n\n\n\n")
+
+	out.write("/* %d folded code points, %d distinct differences, %d blocks of %d code points, %d bytes of tables */\n\n"
+	          % (sum(1 for d in deltas if d != 0), len(distinctDeltas), len(foldBlocks), 1 << foldShift,
+	             foldSize + 4 * len(distinctDeltas)))
+
+	out.write("/* what folding adds to a code point */\n")
+	writeArray(out, "static const int unicoder_foldDeltas[%d]" % len(distinctDeltas), distinctDeltas, 8)
+	out.write("\n\n")
+
+	out.write("/* block of each code point >> UNICODER_FOLD_SHIFT */\n")
+	writeArray(out, "static const %s unicoder_foldBlocks[%d]" % (typeFor(len(foldBlocks)), len(foldIndex)), foldIndex, 16)
+	out.write("\n\n")
+
+	out.write("/* difference number of each code point in a block */\n")
+	writeArray(out, "static const %s unicoder_foldIndex[%d << UNICODER_FOLD_SHIFT]" % (typeFor(len(distinctDeltas)), len(foldBlocks)),
+	           [v for block in foldBlocks for v in block], 16)
+
+
+if __name__ == "__main__":
+	main()
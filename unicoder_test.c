@@ -0,0 +1,517 @@
+/******
+Copyright (C) 2014 Justin Adams
+
+    This file is part of Unicoder.
+
+    Unicoder is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License
+    (version 2.1 only) as published by the Free Software Foundation.
+
+    Unicoder is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with Unicoder.  If not, see <http://www.gnu.org/licenses/>.
+****/
+
+
+/*
+Kernel tier tests.
+
+Build next to the library with the same flags you ship it with, for example
+
+	cc -O2 unicoder.c unicoder_test.c -o unicoder_test -lpthread
+
+and run
+
+	./unicoder_test                           every tier the cpu has against the scalar loops
+
+options:
+	-n count  number of random texts (default 2000)
+	-s seed   seed for the texts (default 1), to repeat a failure
+	-v        print every mismatch, not just the first few
+
+Each text is made up in one encoding from a random mix of scripts, at a random length and a random
+offset from an aligned address, and about one in four has a byte changed or its end cut off. Every
+function with vector kernels runs on it with unicoder_setCpuTier at scalar, then again at each tier
+the cpu and the build have, and everything it returns or writes has to be the same: transcode to
+every encoding into a roomy and a tight buffer, transcodedLength, utf8_validate, caseFold, an index
+with its seeks and slices, and the splitter on lines and on a code point of the text. The exit
+status is 0 when nothing differs.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unicoder.h"
+
+
+#define  TEST_ENCODINGS  9
+
+static const char* test_encodingNames[TEST_ENCODINGS + 1]=
+{
+	"-", "ascii", "utf8", "utf16be", "utf16le", "utf32be", "utf32le", "8859-1", "8859-15", "cp1252"
+};
+
+static const char* test_tierNames[]= { "scalar", "sse4.1", "avx2", "avx512" };
+
+
+/* settings from the command line */
+static unsigned long test_count= 2000;
+static unsigned int test_seed= 1;
+static int test_verbose= 0;
+
+static unsigned long test_mismatches= 0;
+static unsigned long test_checks= 0;
+
+
+
+
+
+
+/* one text in one encoding, the bytes at an odd offset into their own allocation */
+typedef struct
+{
+	unsigned long number;
+	unsigned int encoding;
+	unsigned char* block;
+	const unsigned char* text;
+	size_t len;
+	unsigned int delimiter; /* a code point that turns up in the text, for the splitter */
+	unsigned int dst; /* encoding the check at hand converts to */
+	size_t interval; /* index interval for the check at hand */
+} test_case;
+
+
+/* everything a function returned or wrote under one tier */
+typedef struct
+{
+	unsigned char* bytes;
+	size_t len, cap;
+} test_log;
+
+
+/* xorshift, so the texts do not depend on the C library */
+static unsigned int test_random(unsigned int below)
+{
+	test_seed ^= test_seed << 13;
+	test_seed ^= test_seed >> 17;
+	test_seed ^= test_seed << 5;
+
+	return test_seed % below;
+}
+
+
+static void test_logBytes(test_log* log, const void* p, size_t n)
+{
+	if(log->len + n > log->cap)
+	{
+		log->cap= 2 * (log->len + n) + 256;
+		log->bytes= (unsigned char*) realloc(log->bytes, log->cap);
+		if(log->bytes == NULL)
+		{
+			fprintf(stderr, "out of memory\n");
+			exit(2);
+		}
+	}
+
+	memcpy(log->bytes + log->len, p, n);
+	log->len += n;
+}
+
+
+static void test_logValue(test_log* log, long long x)
+{
+	test_logBytes(log, &x, sizeof(x));
+}
+
+
+
+
+
+
+/* code points for a mix of scripts: 0 ascii, 1 latin-1, 2 windows-1252 punctuation, 3 cyrillic and */
+/* greek, 4 cjk, 5 emoji, 6 the far end of unicode, 7 line ends */
+static unsigned int test_codePoint(int script)
+{
+	static const unsigned int punctuation[]= { 0x20ac, 0x201c, 0x201d, 0x2019, 0x2026, 0x2014, 0x0152, 0x0161 };
+	static const unsigned int far[]= { 0xd7ff, 0xe000, 0xfeff, 0xfffd, 0xffff, 0x10000, 0x10fff0, 0x10ffff };
+
+	switch(script)
+	{
+		case 0: return 0x20 + test_random(0x5f);
+		case 1: return 0xa0 + test_random(0x60);
+		case 2: return punctuation[test_random(8)];
+		case 3: return (test_random(2) == 0) ? 0x0400 + test_random(0x60) : 0x0391 + test_random(0x38);
+		case 4: return 0x4e00 + test_random(0x5200);
+		case 5: return 0x1f300 + test_random(0x800);
+		case 6: return far[test_random(8)];
+	}
+
+	return (test_random(2) == 0) ? '\n' : '\r';
+}
+
+
+/* makes up text number n, NULL in block if it could not be written */
+static void test_generate(test_case* c, unsigned long n)
+{
+	unsigned int* cps;
+	unsigned char* utf32;
+	unsigned char unit[4];
+	unsigned int scripts;
+	size_t count, cap, offset, i;
+	int script, ret;
+
+	memset(c, 0, sizeof(*c));
+	c->number= n;
+	c->encoding= 1 + test_random(TEST_ENCODINGS);
+
+	/* mostly short, where the scalar tails do the work, now and then long enough for the vector loops */
+	switch(test_random(4))
+	{
+		case 0:  count= test_random(17); break;
+		case 1:  count= test_random(200); break;
+		case 2:  count= 200 + test_random(2000); break;
+		default: count= 4000 + test_random(20000); break;
+	}
+
+	/* a few scripts a text, and the single byte encodings only the ones near what they hold */
+	scripts= 1 | (1u << 7) | test_random(0x80);
+	if(c->encoding == UNICODER_ASCII)
+		scripts= 1 | (1u << 7);
+	else if(c->encoding >= UNICODER_ISO8859_1)
+		scripts &= 0x87;
+
+	cps= (unsigned int*) malloc((count + 1) * sizeof(unsigned int));
+	utf32= (unsigned char*) malloc(4 * count + 4);
+
+	for(i= 0; i < count; i++)
+	{
+		do
+			script= (int) test_random(8);
+		while(!(scripts & (1u << script)));
+
+		/* lines are not all that short */
+		if(script == 7  &&  test_random(8) != 0)
+			script= 0;
+
+		cps[i]= test_codePoint(script);
+
+		/* windows-1252 punctuation in latin-1, or the few latin-1 letters 8859-15 gave up */
+		if(unicoder_writeCodePoint(unit, cps[i], c->encoding) < 0)
+			cps[i]= test_codePoint(0);
+
+		unicoder_writeCodePoint(utf32 + 4 * i, cps[i], UNICODER_UTF32LE);
+	}
+
+	c->delimiter= (count > 0) ? cps[test_random((unsigned int) count)] : ' ';
+
+	/* the text goes offset bytes into its block, to try every alignment */
+	offset= test_random(64);
+	cap= 4 * count + 4;
+	c->block= (unsigned char*) malloc(offset + cap);
+
+	ret= unicoder_transcode(utf32, 4 * count, UNICODER_UTF32LE, c->block + offset, cap, c->encoding, NULL, &c->len);
+	free(utf32);
+	free(cps);
+
+	if(ret != 0)
+	{
+		free(c->block);
+		c->block= NULL;
+		return;
+	}
+
+	c->text= c->block + offset;
+
+	/* one in four gets broken: a byte changed to anything, or the end cut off */
+	if(c->len > 0  &&  test_random(4) == 0)
+	{
+		if(test_random(2) == 0)
+			c->block[offset + test_random((unsigned int) c->len)]= (unsigned char) test_random(256);
+		else
+			c->len -= 1 + test_random((c->len < 3) ? (unsigned int) c->len : 3);
+	}
+}
+
+
+
+
+
+
+static void test_transcode(const test_case* c, test_log* log)
+{
+	unsigned char* dst;
+	size_t cap, tight, consumed, produced;
+	int ret;
+
+	cap= 4 * c->len + 64;
+	tight= (c->len < 8) ? c->len : c->len / 2 + 3;
+	dst= (unsigned char*) malloc(cap);
+
+	ret= unicoder_transcode(c->text, c->len, c->encoding, dst, cap, c->dst, &consumed, &produced);
+	test_logValue(log, ret);
+	test_logValue(log, (long long) consumed);
+	test_logValue(log, (long long) produced);
+	test_logBytes(log, dst, produced);
+
+	/* a buffer that fills up part way, so the kernels stop where the scalar loop does */
+	ret= unicoder_transcode(c->text, c->len, c->encoding, dst, tight, c->dst, &consumed, &produced);
+	test_logValue(log, ret);
+	test_logValue(log, (long long) consumed);
+	test_logValue(log, (long long) produced);
+	test_logBytes(log, dst, produced);
+
+	free(dst);
+}
+
+
+static void test_transcodedLength(const test_case* c, test_log* log)
+{
+	size_t length;
+	int ret;
+
+	ret= unicoder_transcodedLength(c->text, c->len, c->encoding, c->dst, &length);
+	test_logValue(log, ret);
+	test_logValue(log, (long long) length);
+}
+
+
+static void test_validate(const test_case* c, test_log* log)
+{
+	size_t offset= 0;
+	int ret;
+
+	/* whatever the text is in, utf-8 validation takes any bytes */
+	ret= unicoder_utf8_validate(c->text, c->len, &offset);
+	test_logValue(log, ret);
+	test_logValue(log, (ret == 0) ? 0 : (long long) offset);
+}
+
+
+static void test_caseFold(const test_case* c, test_log* log)
+{
+	unsigned char* dst;
+	size_t cap, consumed, produced;
+	int ret;
+
+	cap= 2 * c->len + 64;
+	dst= (unsigned char*) malloc(cap);
+
+	ret= unicoder_caseFold(c->text, c->len, c->encoding, dst, cap, &consumed, &produced);
+	test_logValue(log, ret);
+	test_logValue(log, (long long) consumed);
+	test_logValue(log, (long long) produced);
+	test_logBytes(log, dst, produced);
+
+	free(dst);
+}
+
+
+static void test_index(const test_case* c, test_log* log)
+{
+	unicoder_index* ix;
+	size_t codePoints, bytes, offset, start, end, n, half;
+	int ret;
+
+	ix= unicoder_index_open(c->encoding, c->interval);
+	if(ix == NULL)
+	{
+		test_logValue(log, -1);
+		return;
+	}
+
+	/* in two appends, the first of which may end inside a code point */
+	half= c->len / 2 + (c->len & 1);
+	ret= unicoder_index_append(ix, c->text, half);
+	test_logValue(log, ret);
+	ret= unicoder_index_append(ix, c->text, c->len);
+	test_logValue(log, ret);
+
+	unicoder_index_length(ix, &codePoints, &bytes);
+	test_logValue(log, (long long) codePoints);
+	test_logValue(log, (long long) bytes);
+
+	for(n= 0; n <= codePoints + 1; n += 1 + n / 16)
+	{
+		offset= 0;
+		ret= unicoder_index_seek(ix, c->text, n, &offset);
+		test_logValue(log, ret);
+		test_logValue(log, (long long) offset);
+	}
+
+	for(n= 0; n < 4; n++)
+	{
+		start= test_random((unsigned int) codePoints + 2);
+		end= start + test_random(100);
+		ret= unicoder_index_slice(ix, c->text, start, end, &start, &end);
+		test_logValue(log, ret);
+		test_logValue(log, (ret == 0) ? (long long) start : 0);
+		test_logValue(log, (ret == 0) ? (long long) end : 0);
+	}
+
+	unicoder_index_close(ix);
+}
+
+
+static void test_split(const test_case* c, test_log* log, unsigned int delimiter)
+{
+	unicoder_splitter s;
+	const unsigned char* record;
+	size_t recordLen;
+	int ret;
+
+	ret= unicoder_splitter_init(&s, c->text, c->len, c->encoding, delimiter);
+	test_logValue(log, ret);
+	if(ret != 0)
+		return;
+
+	while((ret= unicoder_splitter_next(&s, &record, &recordLen)) == 0)
+	{
+		test_logValue(log, record - c->text);
+		test_logValue(log, (long long) recordLen);
+	}
+
+	test_logValue(log, ret);
+}
+
+
+static void test_splitLines(const test_case* c, test_log* log)
+{
+	test_split(c, log, UNICODER_LINES);
+}
+
+
+static void test_splitDelimiter(const test_case* c, test_log* log)
+{
+	test_split(c, log, c->delimiter);
+}
+
+
+
+
+
+
+/* runs check on c at the scalar tier and then at every other tier in tiers, counting differences */
+static void test_compare(const char* function, void (*check)(const test_case*, test_log*), const test_case* c,
+                         const unsigned int* tiers, unsigned int tierCount)
+{
+	static test_log scalar, vector;
+	unsigned int seed, t;
+
+	/* index slices draw random code point numbers, every tier has to get the same ones */
+	seed= test_seed;
+
+	unicoder_setCpuTier(UNICODER_CPU_SCALAR);
+	scalar.len= 0;
+	check(c, &scalar);
+
+	for(t= 0; t < tierCount; t++)
+	{
+		test_seed= seed;
+		unicoder_setCpuTier(tiers[t]);
+		vector.len= 0;
+		check(c, &vector);
+		test_checks++;
+
+		if(vector.len != scalar.len  ||  memcmp(vector.bytes, scalar.bytes, scalar.len) != 0)
+		{
+			test_mismatches++;
+			if(test_verbose  ||  test_mismatches <= 20)
+			{
+				printf("text %lu (%s, %lu bytes, offset %lu): %s", c->number, test_encodingNames[c->encoding],
+				       (unsigned long) c->len, (unsigned long) (c->text - c->block), function);
+				if(check == test_transcode  ||  check == test_transcodedLength)
+					printf(" to %s", test_encodingNames[c->dst]);
+				printf(" differs from scalar at %s\n", test_tierNames[tiers[t]]);
+			}
+		}
+	}
+}
+
+
+static void test_text(test_case* c, const unsigned int* tiers, unsigned int tierCount)
+{
+	for(c->dst= UNICODER_ASCII; c->dst <= UNICODER_CP1252; c->dst++)
+	{
+		test_compare("unicoder_transcode", test_transcode, c, tiers, tierCount);
+		test_compare("unicoder_transcodedLength", test_transcodedLength, c, tiers, tierCount);
+	}
+
+	test_compare("unicoder_utf8_validate", test_validate, c, tiers, tierCount);
+	test_compare("unicoder_caseFold", test_caseFold, c, tiers, tierCount);
+
+	c->interval= 1 + test_random(64);
+	test_compare("unicoder_index", test_index, c, tiers, tierCount);
+
+	test_compare("unicoder_splitter lines", test_splitLines, c, tiers, tierCount);
+	test_compare("unicoder_splitter delimiter", test_splitDelimiter, c, tiers, tierCount);
+}
+
+
+
+
+
+
+int main(int argc, char** argv)
+{
+	test_case c;
+	unsigned int tiers[3], tierCount= 0, t;
+	unsigned long n, skipped= 0;
+	int i, original;
+
+	for(i= 1; i < argc; i++)
+	{
+		if(strcmp(argv[i], "-v") == 0)
+			test_verbose= 1;
+		else if(strcmp(argv[i], "-n") == 0  &&  i + 1 < argc)
+			test_count= strtoul(argv[++i], NULL, 10);
+		else if(strcmp(argv[i], "-s") == 0  &&  i + 1 < argc)
+			test_seed= (unsigned int) strtoul(argv[++i], NULL, 10);
+		else
+		{
+			fprintf(stderr, "usage: %s [-n count] [-s seed] [-v]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	/* xorshift never leaves 0 */
+	if(test_seed == 0)
+		test_seed= 1;
+
+	original= unicoder_cpuTier();
+	for(t= UNICODER_CPU_SSE41; t <= UNICODER_CPU_AVX512; t++)
+	{
+		if(unicoder_setCpuTier(t) == 0)
+			tiers[tierCount++]= t;
+	}
+
+	printf("tiers:");
+	for(t= 0; t < tierCount; t++)
+		printf(" %s", test_tierNames[tiers[t]]);
+	printf("%s\n", (tierCount == 0) ? " none past scalar, nothing to compare" : "");
+
+	for(n= 0; n < test_count; n++)
+	{
+		/* the texts are made at the scalar tier, which is the one everything is held to */
+		unicoder_setCpuTier(UNICODER_CPU_SCALAR);
+		test_generate(&c, n);
+		if(c.block == NULL)
+		{
+			skipped++;
+			continue;
+		}
+
+		test_text(&c, tiers, tierCount);
+		free(c.block);
+	}
+
+	unicoder_setCpuTier((unsigned int) original);
+
+	printf("%lu texts (%lu skipped), %lu checks, %lu mismatches\n", test_count, skipped, test_checks, test_mismatches);
+	return (test_mismatches == 0) ? 0 : 1;
+}
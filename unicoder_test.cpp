@@ -0,0 +1,290 @@
+/******
+Copyright (C) 2014 Justin Adams
+
+    This file is part of Unicoder.
+
+    Unicoder is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License
+    (version 2.1 only) as published by the Free Software Foundation.
+
+    Unicoder is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with Unicoder.  If not, see <http://www.gnu.org/licenses/>.
+****/
+
+
+/*
+C++ codec pair tests.
+
+Build next to the library, the library as C, for example
+
+	cc -O2 -c unicoder.c
+	c++ -std=c++17 -O2 unicoder.o unicoder_test.cpp -o unicoder_test_cpp -lpthread
+
+and run
+
+	./unicoder_test_cpp                       every pair of unicoder.hpp against unicoder_transcode
+
+options:
+	-n count  number of random texts (default 2000)
+	-s seed   seed for the texts (default 1), to repeat a failure
+	-v        print every mismatch, not just the first few
+
+The texts are made up as unicoder_test.c makes them: a random mix of scripts in one encoding, at a
+random length, about one in four with a byte changed or its end cut off. Each goes to every encoding
+through unicoder::transcode<From, To> and through unicoder_transcode, into a roomy and a tight
+buffer, and the two have to return, consume and write the same. The exit status is 0 when nothing
+differs.
+*/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#include "unicoder.hpp"
+
+
+#define  TEST_ENCODINGS  9
+
+static const char* test_encodingNames[TEST_ENCODINGS + 1]=
+{
+	"-", "ascii", "utf8", "utf16be", "utf16le", "utf32be", "utf32le", "8859-1", "8859-15", "cp1252"
+};
+
+
+/* the code pages convert at compile time like the rest */
+constexpr auto test_cp1252Euro= UNICODER_LITERAL(UNICODER_CP1252, u8"€");
+constexpr auto test_iso8859_15Euro= UNICODER_LITERAL(UNICODER_ISO8859_15, u8"€");
+constexpr auto test_iso8859_1Y= UNICODER_LITERAL(UNICODER_ISO8859_1, u8"ÿ");
+
+static_assert(test_cp1252Euro.size() == 1  &&  test_cp1252Euro[0] == 0x80, "cp1252 euro sign");
+static_assert(test_iso8859_15Euro.size() == 1  &&  test_iso8859_15Euro[0] == 0xa4, "8859-15 euro sign");
+static_assert(test_iso8859_1Y.size() == 1  &&  test_iso8859_1Y[0] == 0xff, "8859-1 y diaeresis");
+
+
+/* settings from the command line */
+static unsigned long test_count= 2000;
+static unsigned int test_seed= 1;
+static int test_verbose= 0;
+
+static unsigned long test_mismatches= 0;
+static unsigned long test_checks= 0;
+
+
+
+
+
+
+typedef int (*test_transcoder)(const unsigned char* src, std::size_t srcLen, unsigned char* dst, std::size_t dstCap,
+                               std::size_t* consumed, std::size_t* produced);
+
+/* unicoder::transcode for every pair, by encoding number */
+static test_transcoder test_pairs[TEST_ENCODINGS + 1][TEST_ENCODINGS + 1];
+
+
+template<unsigned int From, unsigned int... To>
+static void test_fillRow(std::integer_sequence<unsigned int, To...>)
+{
+	test_transcoder row[]= { &unicoder::transcode<From, To + 1>... };
+	std::size_t i;
+
+	for(i= 0; i < sizeof...(To); i++)
+		test_pairs[From][i + 1]= row[i];
+}
+
+
+template<unsigned int... From>
+static void test_fill(std::integer_sequence<unsigned int, From...>)
+{
+	int rows[]= { (test_fillRow<From + 1>(std::make_integer_sequence<unsigned int, TEST_ENCODINGS>()), 0)... };
+
+	(void) rows;
+}
+
+
+
+
+
+
+/* one text in one encoding */
+typedef struct
+{
+	unsigned long number;
+	unsigned int encoding;
+	unsigned char* text;
+	std::size_t len;
+} test_case;
+
+
+/* xorshift, so the texts do not depend on the C library */
+static unsigned int test_random(unsigned int below)
+{
+	test_seed ^= test_seed << 13;
+	test_seed ^= test_seed >> 17;
+	test_seed ^= test_seed << 5;
+
+	return test_seed % below;
+}
+
+
+/* code points for a mix of scripts: 0 ascii, 1 latin-1, 2 windows-1252 punctuation, 3 cyrillic and */
+/* greek, 4 cjk, 5 emoji, 6 the far end of unicode */
+static unsigned int test_codePoint(int script)
+{
+	static const unsigned int punctuation[]= { 0x20ac, 0x201c, 0x201d, 0x2019, 0x2026, 0x2014, 0x0152, 0x0161 };
+	static const unsigned int far[]= { 0xd7ff, 0xe000, 0xfeff, 0xfffd, 0xffff, 0x10000, 0x10fff0, 0x10ffff };
+
+	switch(script)
+	{
+		case 0: return 0x20 + test_random(0x5f);
+		case 1: return 0xa0 + test_random(0x60);
+		case 2: return punctuation[test_random(8)];
+		case 3: return (test_random(2) == 0) ? 0x0400 + test_random(0x60) : 0x0391 + test_random(0x38);
+		case 4: return 0x4e00 + test_random(0x5200);
+		case 5: return 0x1f300 + test_random(0x800);
+	}
+
+	return far[test_random(8)];
+}
+
+
+/* makes up text number n, NULL in text if it could not be written */
+static void test_generate(test_case* c, unsigned long n)
+{
+	unsigned char* utf32;
+	unsigned int scripts;
+	std::size_t count, i;
+	int ret;
+
+	std::memset(c, 0, sizeof(*c));
+	c->number= n;
+	c->encoding= 1 + test_random(TEST_ENCODINGS);
+
+	count= (test_random(2) == 0) ? test_random(17) : test_random(2000);
+
+	/* a few scripts a text, code points the encoding cannot take come out in the other direction */
+	scripts= 1 | test_random(0x80);
+	utf32= (unsigned char*) std::malloc(4 * count + 4);
+
+	for(i= 0; i < count; i++)
+	{
+		int script;
+
+		do
+			script= (int) test_random(7);
+		while(!(scripts & (1u << script)));
+
+		unicoder_writeCodePoint(utf32 + 4 * i, test_codePoint(script), UNICODER_UTF32LE);
+	}
+
+	c->text= (unsigned char*) std::malloc(4 * count + 4);
+	ret= unicoder_transcodeLossy(utf32, 4 * count, UNICODER_UTF32LE, c->text, 4 * count + 4, c->encoding,
+	                             UNICODER_POLICY_SKIP, NULL, 0, NULL, NULL, &c->len);
+	std::free(utf32);
+
+	if(ret != 0)
+	{
+		std::free(c->text);
+		c->text= NULL;
+		return;
+	}
+
+	/* one in four gets broken: a byte changed to anything, or the end cut off */
+	if(c->len > 0  &&  test_random(4) == 0)
+	{
+		if(test_random(2) == 0)
+			c->text[test_random((unsigned int) c->len)]= (unsigned char) test_random(256);
+		else
+			c->len -= 1 + test_random((c->len < 3) ? (unsigned int) c->len : 3);
+	}
+}
+
+
+
+
+
+
+/* c to dst into cap bytes both ways, counting a difference */
+static void test_pair(const test_case* c, unsigned int dst, std::size_t cap, const char* buffer)
+{
+	unsigned char* a;
+	unsigned char* b;
+	std::size_t consumedA= 0, producedA= 0, consumedB= 0, producedB= 0;
+	int retA, retB;
+
+	a= (unsigned char*) std::malloc(cap + 1);
+	b= (unsigned char*) std::malloc(cap + 1);
+
+	retA= unicoder_transcode(c->text, c->len, c->encoding, a, cap, dst, &consumedA, &producedA);
+	retB= test_pairs[c->encoding][dst](c->text, c->len, b, cap, &consumedB, &producedB);
+	test_checks++;
+
+	if(retA != retB  ||  consumedA != consumedB  ||  producedA != producedB  ||  std::memcmp(a, b, producedA) != 0)
+	{
+		test_mismatches++;
+		if(test_verbose  ||  test_mismatches <= 20)
+			std::printf("text %lu (%s, %lu bytes) to %s, %s buffer: unicoder_transcode %d at %lu, unicoder::transcode %d at %lu\n",
+			            c->number, test_encodingNames[c->encoding], (unsigned long) c->len, test_encodingNames[dst],
+			            buffer, retA, (unsigned long) consumedA, retB, (unsigned long) consumedB);
+	}
+
+	std::free(a);
+	std::free(b);
+}
+
+
+int main(int argc, char** argv)
+{
+	test_case c;
+	unsigned long n, skipped= 0;
+	unsigned int dst;
+	int i;
+
+	for(i= 1; i < argc; i++)
+	{
+		if(std::strcmp(argv[i], "-v") == 0)
+			test_verbose= 1;
+		else if(std::strcmp(argv[i], "-n") == 0  &&  i + 1 < argc)
+			test_count= std::strtoul(argv[++i], NULL, 10);
+		else if(std::strcmp(argv[i], "-s") == 0  &&  i + 1 < argc)
+			test_seed= (unsigned int) std::strtoul(argv[++i], NULL, 10);
+		else
+		{
+			std::fprintf(stderr, "usage: %s [-n count] [-s seed] [-v]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	/* xorshift never leaves 0 */
+	if(test_seed == 0)
+		test_seed= 1;
+
+	test_fill(std::make_integer_sequence<unsigned int, TEST_ENCODINGS>());
+
+	for(n= 0; n < test_count; n++)
+	{
+		test_generate(&c, n);
+		if(c.text == NULL)
+		{
+			skipped++;
+			continue;
+		}
+
+		for(dst= UNICODER_ASCII; dst <= UNICODER_CP1252; dst++)
+		{
+			test_pair(&c, dst, 4 * c.len + 64, "roomy");
+			test_pair(&c, dst, (c.len < 8) ? c.len : c.len / 2 + 3, "tight");
+		}
+
+		std::free(c.text);
+	}
+
+	std::printf("%lu texts (%lu skipped), %lu checks, %lu mismatches\n", test_count, skipped, test_checks, test_mismatches);
+	return (test_mismatches == 0) ? 0 : 1;
+}